@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 
 /***************************************************************************//**
@@ -88,6 +89,10 @@ int plasma_clag2z(int m, int n,
     if (imin(n, m) == 0)
       return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "lag2z", PlasmaComplexFloat, m, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 
 /******************************************************************************/
@@ -51,6 +52,10 @@ int plasma_dzamax(plasma_enum_t colrow,
     if (imin(n, m) == 0)
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "amax", PlasmaComplexDouble, m, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -18,12 +18,25 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
 /******************************************************************************/
 void plasma_pzdesc2ge(plasma_desc_t A,
                       plasma_complex64_t *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request)
 {
+    // Nothing to translate if A describes pA itself in LAPACK layout.
+    if (A.type == PlasmaGeneralLapack && A.matrix == pA)
+        return;
+
+    // Translate back in place even if the sequence failed,
+    // so that pA is restored to LAPACK layout.
+    if (A.inplace != NULL) {
+        plasma_desc_desc2ge_inplace(A, sequence);
+        return;
+    }
+
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
@@ -46,11 +59,70 @@ void plasma_pzdesc2ge(plasma_desc_t A,
             f77 = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
             bdl = (plasma_complex64_t*)plasma_tile_addr(A, m, n);
 
-            core_omp_zlacpy(PlasmaGeneral, PlasmaNoTrans,
-                            y2-y1, x2-x1,
-                            &(bdl[x1*A.nb+y1]), ldt,
-                            &(f77[x1*lda+y1]), lda,
-                            sequence, request);
+            core_omp_zlacpy_translate(y2-y1, x2-x1,
+                                      &(bdl[x1*A.nb+y1]), ldt,
+                                      &(f77[x1*lda+y1]), lda,
+                                      sequence, request);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Translates from tile to LAPACK layout one tile column per task.
+ *  Each task waits for the tiles (min(n, mt-1), n) and (mt-1, n),
+ *  which are the last ones written in column n by plasma_pzgetrf(),
+ *  so that columns stream back as soon as they are final.
+ ******************************************************************************/
+void plasma_pzdesc2ge_col(plasma_desc_t A,
+                          plasma_complex64_t *pA, int lda,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Nothing to translate if A describes pA itself in LAPACK layout.
+    if (A.type == PlasmaGeneralLapack && A.matrix == pA)
+        return;
+
+    // Translate back in place even if the sequence failed,
+    // so that pA is restored to LAPACK layout.
+    if (A.inplace != NULL) {
+        plasma_desc_desc2ge_inplace(A, sequence);
+        return;
+    }
+
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int n = 0; n < A.nt; n++) {
+        plasma_complex64_t *a1, *a2;
+        a1 = A(imin(n, A.mt-1), n);
+        a2 = A(A.mt-1, n);
+
+        int nvan = plasma_tile_nview(A, n);
+        int lda1 = plasma_tile_mmain(A, imin(n, A.mt-1));
+        int lda2 = plasma_tile_mmain(A, A.mt-1);
+
+        #pragma omp task depend(in:a1[0:lda1*nvan]) \
+                         depend(in:a2[0:lda2*nvan])
+        {
+            for (int m = 0; m < A.mt; m++) {
+                int ldt = plasma_tile_mmain(A, m);
+                int x1 = n == 0 ? A.j%A.nb : 0;
+                int y1 = m == 0 ? A.i%A.mb : 0;
+                int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                plasma_complex64_t *f77 =
+                    &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                plasma_complex64_t *bdl =
+                    (plasma_complex64_t*)plasma_tile_addr(A, m, n);
+
+                core_omp_zlacpy_translate(y2-y1, x2-x1,
+                                          &(bdl[x1*A.nb+y1]), ldt,
+                                          &(f77[x1*lda+y1]), lda,
+                                          sequence, request);
+            }
+            #pragma omp taskwait
         }
     }
 }
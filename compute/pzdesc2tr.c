@@ -41,11 +41,10 @@ void plasma_pzdesc2tr(plasma_desc_t A,
             plasma_complex64_t *f77 = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
             plasma_complex64_t *bdl = (plasma_complex64_t*)plasma_tile_addr(A, m, n);
 
-            core_omp_zlacpy(PlasmaGeneral, PlasmaNoTrans,
-                            y2-y1, x2-x1,
-                            &(bdl[x1*A.nb+y1]), ldt,
-                            &(f77[x1*lda+y1]), lda,
-                            sequence, request);
+            core_omp_zlacpy_translate(y2-y1, x2-x1,
+                                      &(bdl[x1*A.nb+y1]), ldt,
+                                      &(f77[x1*lda+y1]), lda,
+                                      sequence, request);
         }
     }
 }
@@ -32,8 +32,13 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
     plasma_context_t *plasma = plasma_context_self();
     int ib = plasma->ib;
     int max_panel_threads = plasma->max_panel_threads;
+    int lookahead = plasma->lookahead;
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        // Stop creating tasks once the sequence has failed.
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         // for band matrix, gm is a multiple of mb,
         // and there is no a10 submatrix
 
@@ -47,9 +52,10 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
         int mak      = imin(A.m-k*A.mb, mvak+A.kl);
         int size_a00 = (A.gm-k*A.mb) * plasma_tile_nmain(A, k);
         int size_i   = imin(mvak, nvak);
+        int priority_k = plasma_lookahead_priority(lookahead, k, k);
         #pragma omp task depend(inout:a00[0:size_a00]) \
-                         depend(out:ipivk[0:size_i]) /*\
-                         priority(1) */
+                         depend(out:ipivk[0:size_i]) \
+                         priority(priority_k)
         {
             volatile int *max_idx = (int*)malloc(max_panel_threads*sizeof(int));
             if (max_idx == NULL)
@@ -68,7 +74,8 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
 
             if (sequence->status == PlasmaSuccess) {
                 for (int rank = 0; rank < max_panel_threads; rank++) {
-                    #pragma omp task shared(barrier) // priority(1)
+                    #pragma omp task shared(barrier, info) \
+                                     priority(priority_k)
                     {
                         // create a view for panel as a "general" submatrix
                         plasma_desc_t view = plasma_desc_view(
@@ -99,12 +106,13 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
             int nvan = plasma_tile_nview(A, n);
             int size_a01 = ldak*nvan;
             int size_a11 = (A.gm-(k+1)*A.mb)*nvan;
+            int priority_n = plasma_lookahead_priority(lookahead, k, n);
 
             #pragma omp task depend(in:a00[0:size_a00]) \
                              depend(inout:ipivk[0:size_i]) \
                              depend(inout:a01[0:size_a01]) \
-                             depend(inout:a11[0:size_a11]) /*\
-                             priority(n == k+1) */
+                             depend(inout:a11[0:size_a11]) \
+                             priority(priority_n)
             {
                 if (sequence->status == PlasmaSuccess) {
                     // geswp
@@ -129,7 +137,7 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
                     for (int m = imax(k+1,n-A.kut); m < imin(k+A.klt, A.mt); m++) {
                         int mvam = plasma_tile_mview(A, m);
 
-                        #pragma omp task // priority(n == k+1)
+                        #pragma omp task priority(priority_n)
                         {
                             core_zgemm(
                                 PlasmaNoTrans, PlasmaNoTrans,
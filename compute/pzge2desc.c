@@ -18,12 +18,25 @@
 #include "plasma_workspace.h"
 #include "core_blas.h"
 
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+
 /******************************************************************************/
 void plasma_pzge2desc(plasma_complex64_t *pA, int lda,
                       plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request)
 {
+    // Nothing to translate if A describes pA itself in LAPACK layout.
+    if (A.type == PlasmaGeneralLapack && A.matrix == pA)
+        return;
+
+    // Translate in place if the tiles are stored in pA, even if the
+    // sequence failed, since the translation back always takes place.
+    if (A.inplace != NULL) {
+        plasma_desc_ge2desc_inplace(A, sequence);
+        return;
+    }
+
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
@@ -46,11 +59,73 @@ void plasma_pzge2desc(plasma_complex64_t *pA, int lda,
             f77 = &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
             bdl = (plasma_complex64_t*)plasma_tile_addr(A, m, n);
 
-            core_omp_zlacpy(PlasmaGeneral, PlasmaNoTrans,
-                            y2-y1, x2-x1,
-                            &(f77[x1*lda+y1]), lda,
-                            &(bdl[x1*A.nb+y1]), ldt,
-                            sequence, request);
+            core_omp_zlacpy_translate(y2-y1, x2-x1,
+                                      &(f77[x1*lda+y1]), lda,
+                                      &(bdl[x1*A.nb+y1]), ldt,
+                                      sequence, request);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Translates from LAPACK to tile layout one tile column per task.
+ *  Each task declares as output the tiles (0, n), (1, n) and (mt-1, n),
+ *  which is how plasma_pzgetrf() and plasma_pzgeswp() track tile columns,
+ *  so that they can start on a column as soon as it is translated.
+ ******************************************************************************/
+void plasma_pzge2desc_col(plasma_complex64_t *pA, int lda,
+                          plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request)
+{
+    // Nothing to translate if A describes pA itself in LAPACK layout.
+    if (A.type == PlasmaGeneralLapack && A.matrix == pA)
+        return;
+
+    // Translate in place if the tiles are stored in pA, even if the
+    // sequence failed, since the translation back always takes place.
+    if (A.inplace != NULL) {
+        plasma_desc_ge2desc_inplace(A, sequence);
+        return;
+    }
+
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int n = 0; n < A.nt; n++) {
+        plasma_complex64_t *a0, *a1, *a2;
+        a0 = A(0, n);
+        a1 = A(imin(1, A.mt-1), n);
+        a2 = A(A.mt-1, n);
+
+        int nvan = plasma_tile_nview(A, n);
+        int lda0 = plasma_tile_mmain(A, 0);
+        int lda1 = plasma_tile_mmain(A, imin(1, A.mt-1));
+        int lda2 = plasma_tile_mmain(A, A.mt-1);
+
+        #pragma omp task depend(out:a0[0:lda0*nvan]) \
+                         depend(out:a1[0:lda1*nvan]) \
+                         depend(out:a2[0:lda2*nvan])
+        {
+            for (int m = 0; m < A.mt; m++) {
+                int ldt = plasma_tile_mmain(A, m);
+                int x1 = n == 0 ? A.j%A.nb : 0;
+                int y1 = m == 0 ? A.i%A.mb : 0;
+                int x2 = n == A.nt-1 ? (A.j+A.n-1)%A.nb+1 : A.nb;
+                int y2 = m == A.mt-1 ? (A.i+A.m-1)%A.mb+1 : A.mb;
+
+                plasma_complex64_t *f77 =
+                    &pA[(size_t)A.nb*lda*n + (size_t)A.mb*m];
+                plasma_complex64_t *bdl =
+                    (plasma_complex64_t*)plasma_tile_addr(A, m, n);
+
+                core_omp_zlacpy_translate(y2-y1, x2-x1,
+                                          &(f77[x1*lda+y1]), lda,
+                                          &(bdl[x1*A.nb+y1]), ldt,
+                                          sequence, request);
+            }
+            #pragma omp taskwait
         }
     }
 }
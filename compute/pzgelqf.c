@@ -37,6 +37,10 @@ void plasma_pzgelqf(plasma_desc_t A, plasma_desc_t T,
     int ib = T.mb;
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        // Stop creating tasks once the sequence has failed.
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         int mvak = plasma_tile_mview(A, k);
         int nvak = plasma_tile_nview(A, k);
         int ldak = plasma_tile_mmain(A, k);
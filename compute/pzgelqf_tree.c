@@ -44,6 +44,10 @@ void plasma_pzgelqf_tree(plasma_desc_t A, plasma_desc_t T,
     int ib = T.mb;
 
     for (int iop = 0; iop < num_operations; iop++) {
+        // Stop creating tasks once the sequence has failed.
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         int j, k, kpiv;
         plasma_enum_t kernel;
         // j is row, k and kpiv are columns
@@ -54,7 +54,7 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                     alpha, A(0, 0), ldam,
                            B(0, 0), ldbk,
                     beta,  C(m, n), ldcm,
-                    sequence, request);
+                    0, sequence, request);
             }
             else if (transa == PlasmaNoTrans) {
                 int ldam = plasma_tile_mmain(A, m);
@@ -72,7 +72,7 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                             alpha, A(m, k), ldam,
                                    B(k, n), ldbk,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
                 //=====================================
@@ -89,7 +89,7 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                             alpha, A(m, k), ldam,
                                    B(n, k), ldbn,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -109,7 +109,7 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                             alpha, A(k, m), ldak,
                                    B(k, n), ldbk,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
                 //==========================================
@@ -127,7 +127,7 @@ void plasma_pzgemm(plasma_enum_t transa, plasma_enum_t transb,
                             alpha, A(k, m), ldak,
                                    B(n, k), ldbn,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -33,22 +33,32 @@ void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+    int lookahead = plasma->lookahead;
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        // Stop creating tasks once the sequence has failed.
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         int mvak = plasma_tile_mview(A, k);
         int nvak = plasma_tile_nview(A, k);
         int ldak = plasma_tile_mmain(A, k);
+        int priority_k = plasma_lookahead_priority(lookahead, k, k);
         core_omp_zgeqrt(
             mvak, nvak, ib,
             A(k, k), ldak,
             T(k, k), T.mb,
             work,
-            sequence, request);
+            priority_k, sequence, request);
 
         for (int n = k+1; n < A.nt; n++) {
             int nvan = plasma_tile_nview(A, n);
+            int priority_n = plasma_lookahead_priority(lookahead, k, n);
             core_omp_zunmqr(
                 PlasmaLeft, Plasma_ConjTrans,
                 mvak, nvan, imin(mvak, nvak), ib,
@@ -56,7 +66,7 @@ void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
                 T(k, k), T.mb,
                 A(k, n), ldak,
                 work,
-                sequence, request);
+                priority_n, sequence, request);
         }
         for (int m = k+1; m < A.mt; m++) {
             int mvam = plasma_tile_mview(A, m);
@@ -67,10 +77,11 @@ void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
                 A(m, k), ldam,
                 T(m, k), T.mb,
                 work,
-                sequence, request);
+                priority_k, sequence, request);
 
             for (int n = k+1; n < A.nt; n++) {
                 int nvan = plasma_tile_nview(A, n);
+                int priority_n = plasma_lookahead_priority(lookahead, k, n);
                 core_omp_ztsmqr(
                     PlasmaLeft, Plasma_ConjTrans,
                     A.mb, nvan, mvam, nvan, nvak, ib,
@@ -79,7 +90,7 @@ void plasma_pzgeqrf(plasma_desc_t A, plasma_desc_t T,
                     A(m, k), ldam,
                     T(m, k), T.mb,
                     work,
-                    sequence, request);
+                    priority_n, sequence, request);
             }
         }
     }
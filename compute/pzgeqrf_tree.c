@@ -42,6 +42,10 @@ void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
     int ib = T.mb;
 
     for (int iop = 0; iop < num_operations; iop++) {
+        // Stop creating tasks once the sequence has failed.
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         int j, k, kpiv;
         plasma_enum_t kernel;
         plasma_tree_get_operation(operations, iop, &kernel, &j, &k, &kpiv);
@@ -57,7 +61,7 @@ void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
                 A(k, j), ldak,
                 T(k, j), T.mb,
                 work,
-                sequence, request);
+                0, sequence, request);
 
             for (int jj = j + 1; jj < A.nt; jj++) {
                 int nvajj = plasma_tile_nview(A, jj);
@@ -69,7 +73,7 @@ void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
                     T(k, j), T.mb,
                     A(k, jj), ldak,
                     work,
-                    sequence, request);
+                    0, sequence, request);
             }
         }
         else if (kernel == PlasmaTtKernel) {
@@ -110,7 +114,7 @@ void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
                 A(k,  j),   ldak,
                 T2(k, j),   T.mb,
                 work,
-                sequence, request);
+                0, sequence, request);
 
             for (int jj = j + 1; jj < A.nt; jj++) {
                 int nvajj = plasma_tile_nview(A, jj);
@@ -123,7 +127,7 @@ void plasma_pzgeqrf_tree(plasma_desc_t A, plasma_desc_t T,
                     A(k,    j),  ldak,
                     T2(k,   j),  T.mb,
                     work,
-                    sequence, request);
+                    0, sequence, request);
             }
         }
         else {
@@ -14,6 +14,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_trace.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include "core_blas.h"
@@ -22,19 +23,18 @@
 
 /******************************************************************************/
 void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
+                    int ib, int max_panel_threads, int lookahead,
                     plasma_sequence_t *sequence, plasma_request_t *request)
 {
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
 
-    // Read parameters from the context.
-    plasma_context_t *plasma = plasma_context_self();
-
-    // Set tiling parameters.
-    int ib = plasma->ib;
-
     for (int k = 0; k < imin(A.mt, A.nt); k++) {
+        // Stop creating tasks once the sequence has failed.
+        if (sequence->status != PlasmaSuccess)
+            break;
+
         plasma_complex64_t *a00, *a20;
         a00 = A(k, k);
         a20 = A(A.mt-1, k);
@@ -47,13 +47,14 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
         int mvak = plasma_tile_mview(A, k);
         int ldak = plasma_tile_mmain(A, k);
 
-        int num_panel_threads = imin(plasma->max_panel_threads,
+        int num_panel_threads = imin(max_panel_threads,
                                      imin(A.mt, A.nt)-k);
+        int priority_k = plasma_lookahead_priority(lookahead, k, k);
         // panel
         #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
                          depend(inout:a20[0:lda20*nvak]) \
                          depend(out:ipiv[k*A.mb:mvak]) \
-                         priority(1)
+                         priority(priority_k)
         {
             volatile int *max_idx = (int*)malloc(num_panel_threads*sizeof(int));
             if (max_idx == NULL)
@@ -72,8 +73,10 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
 
             if (sequence->status == PlasmaSuccess) {
                 for (int rank = 0; rank < num_panel_threads; rank++) {
-                    #pragma omp task shared(barrier) priority(1)
+                    #pragma omp task shared(barrier, info) \
+                                     priority(priority_k)
                     {
+                        PLASMA_TRACE_START();
                         plasma_desc_t view =
                             plasma_desc_view(A,
                                              k*A.mb, k*A.nb,
@@ -86,6 +89,24 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
 
                         if (info != 0)
                             plasma_request_fail(sequence, request, k*A.mb+info);
+
+                        // The flops and dependencies of the panel are
+                        // recorded once.
+                        if (rank == 0) {
+                            double m = view.m;
+                            PLASMA_TRACE_TASK(
+                                "core_omp_zgetrf",
+                                0.5*m*nvak*nvak - (double)nvak*nvak*nvak/6,
+                                sequence,
+                                {a00, a00+ma00k*na00k, PlasmaGraphInout},
+                                {a20, a20+lda20*nvak,  PlasmaGraphInout},
+                                {ipiv+k*A.mb, ipiv+k*A.mb+mvak,
+                                 PlasmaGraphInout});
+                        }
+                        else {
+                            PLASMA_TRACE_TASK("core_omp_zgetrf", 0.0, sequence,
+                                                  {a00, a00, PlasmaGraphNone});
+                        }
                     }
                 }
             }
@@ -109,6 +130,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
             int lda21 = plasma_tile_mmain(A, A.mt-1);
 
             int nvan = plasma_tile_nview(A, n);
+            int priority_n = plasma_lookahead_priority(lookahead, k, n);
 
             #pragma omp task depend(in:a00[0:ma00k*na00k]) \
                              depend(in:a20[0:lda20*nvak]) \
@@ -116,7 +138,7 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                              depend(inout:a01[0:ldak*nvan]) \
                              depend(inout:a11[0:ma11k*na11n]) \
                              depend(inout:a21[0:lda21*nvan]) \
-                             priority(n == k+1)
+                             priority(priority_n)
             {
                 if (sequence->status == PlasmaSuccess) {
                     // geswp
@@ -124,28 +146,48 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                     int k2 = imin(k*A.mb+A.mb, A.m);
                     plasma_desc_t view =
                         plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
-                    core_zgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+                    {
+                        PLASMA_TRACE_START();
+                        core_zgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+                        PLASMA_TRACE_TASK(
+                            "core_omp_zgeswp", 0.0, sequence,
+                            {a00, a00+ma00k*na00k, PlasmaGraphIn},
+                            {a20, a20+lda20*nvak,  PlasmaGraphIn},
+                            {ipiv+k*A.mb, ipiv+k*A.mb+mvak, PlasmaGraphIn},
+                            {a01, a01+ldak*nvan,   PlasmaGraphInout},
+                            {a11, a11+ma11k*na11n, PlasmaGraphInout},
+                            {a21, a21+lda21*nvan,  PlasmaGraphInout});
+                    }
 
                     // trsm
-                    core_ztrsm(PlasmaLeft, PlasmaLower,
-                               PlasmaNoTrans, PlasmaUnit,
-                               mvak, nvan,
-                               1.0, A(k, k), ldak,
-                                    A(k, n), ldak);
+                    {
+                        PLASMA_TRACE_START();
+                        core_ztrsm(PlasmaLeft, PlasmaLower,
+                                   PlasmaNoTrans, PlasmaUnit,
+                                   mvak, nvan,
+                                   1.0, A(k, k), ldak,
+                                        A(k, n), ldak);
+                        PLASMA_TRACE_TASK("core_omp_ztrsm",
+                                          0.5*nvan*mvak*mvak, sequence,
+                                          {a00, a00+ldak*nvak, PlasmaGraphIn},
+                                          {a01, a01+ldak*nvan,
+                                           PlasmaGraphInout});
+                    }
                     // gemm
+                    // The tasks write distinct tiles, so they run
+                    // concurrently, on the socket of A(m, n) if
+                    // PlasmaTaskAffinity is enabled.
                     for (int m = k+1; m < A.mt; m++) {
                         int mvam = plasma_tile_mview(A, m);
                         int ldam = plasma_tile_mmain(A, m);
 
-                        #pragma omp task priority(n == k+1)
-                        {
-                            core_zgemm(
-                                PlasmaNoTrans, PlasmaNoTrans,
-                                mvam, nvan, A.nb,
-                                -1.0, A(m, k), ldam,
-                                      A(k, n), ldak,
-                                1.0,  A(m, n), ldam);
-                        }
+                        core_omp_zgemm(
+                            PlasmaNoTrans, PlasmaNoTrans,
+                            mvam, nvan, A.nb,
+                            -1.0, A(m, k), ldam,
+                                  A(k, n), ldak,
+                            1.0,  A(m, n), ldam,
+                            priority_n, sequence, request);
                     }
                 }
                 #pragma omp taskwait
@@ -163,11 +205,16 @@ void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
                          depend(inout:akk[0:makk*nakk])
         {
             if (sequence->status == PlasmaSuccess) {
+                PLASMA_TRACE_START();
                 plasma_desc_t view =
                     plasma_desc_view(A, 0, (k-1)*A.nb, A.m, A.nb);
                 int k1 = k*A.mb+1;
                 int k2 = imin(A.m, A.n);
                 core_zgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+                PLASMA_TRACE_TASK(
+                    "core_omp_zgeswp", 0.0, sequence,
+                    {ipiv, ipiv+imin(A.m, A.n), PlasmaGraphIn},
+                    {akk, akk+makk*nakk, PlasmaGraphInout});
             }
         }
     }
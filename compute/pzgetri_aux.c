@@ -82,7 +82,7 @@ void plasma_pzgetri_aux(plasma_desc_t A, plasma_desc_t W,
                      -1.0, A(m, n), ldam,
                            W( n ),  ldwn,
                       1.0, A(m, k), ldam,
-                      sequence, request);
+                      0, sequence, request);
             }
         }
 
@@ -96,7 +96,7 @@ void plasma_pzgetri_aux(plasma_desc_t A, plasma_desc_t W,
                 mvam, nvak,
                 1.0, W( k ),   ldwk,
                      A( m, k ),ldam,
-                sequence, request );
+                0, sequence, request);
         }
     }
 }
@@ -0,0 +1,197 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_barrier.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_graph.h"
+#include "plasma_internal.h"
+#include "plasma_trace.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#include <sched.h>
+#include <omp.h>
+
+#define T(node, t) (plasma_complex64_t*) \
+    ((char*)descs[(node)->desc[t]].matrix + (node)->offset[t])
+
+// number of polls of an empty slot before yielding the processor
+static const int MaxSpins = 1024;
+
+/******************************************************************************/
+// Runs a recorded task on the tiles of the descriptors.
+static void plasma_pzgraph_node(const plasma_graph_node_t *node,
+                                const plasma_desc_t *descs,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Counted as the tasks of the core_omp_*() functions they replace.
+    PLASMA_TRACE_START();
+    const char *name = NULL;
+    double fmas = 0.0;
+    switch (node->kernel) {
+    case PlasmaGraphGemm:
+        core_zgemm(node->param[0], node->param[1],
+                   node->dim[0], node->dim[1], node->dim[2],
+                   (plasma_complex64_t)node->alpha, T(node, 0), node->ld[0],
+                                                    T(node, 1), node->ld[1],
+                   (plasma_complex64_t)node->beta,  T(node, 2), node->ld[2]);
+        name = "core_omp_zgemm";
+        fmas = (double)node->dim[0]*node->dim[1]*node->dim[2];
+        break;
+    case PlasmaGraphHerk:
+        core_zherk(node->param[0], node->param[1],
+                   node->dim[0], node->dim[1],
+                   creal(node->alpha), T(node, 0), node->ld[0],
+                   creal(node->beta),  T(node, 1), node->ld[1]);
+        name = "core_omp_zherk";
+        fmas = 0.5*node->dim[1]*node->dim[0]*(node->dim[0]+1);
+        break;
+    case PlasmaGraphPotrf: {
+        int info = core_zpotrf(node->param[0],
+                               node->dim[0],
+                               T(node, 0), node->ld[0]);
+        if (info != 0)
+            plasma_request_fail(sequence, request, node->iinfo+info);
+        name = "core_omp_zpotrf";
+        fmas = (double)node->dim[0]*node->dim[0]*node->dim[0]/6;
+        break;
+    }
+    case PlasmaGraphSyrk:
+        core_zsyrk(node->param[0], node->param[1],
+                   node->dim[0], node->dim[1],
+                   (plasma_complex64_t)node->alpha, T(node, 0), node->ld[0],
+                   (plasma_complex64_t)node->beta,  T(node, 1), node->ld[1]);
+        name = "core_omp_zsyrk";
+        fmas = 0.5*node->dim[1]*node->dim[0]*(node->dim[0]+1);
+        break;
+    case PlasmaGraphTrsm:
+        core_ztrsm(node->param[0], node->param[1],
+                   node->param[2], node->param[3],
+                   node->dim[0], node->dim[1],
+                   (plasma_complex64_t)node->alpha, T(node, 0), node->ld[0],
+                                                    T(node, 1), node->ld[1]);
+        name = "core_omp_ztrsm";
+        fmas = node->param[0] == PlasmaLeft ?
+               0.5*node->dim[1]*node->dim[0]*node->dim[0] :
+               0.5*node->dim[0]*node->dim[1]*node->dim[1];
+        break;
+    }
+    // The tiles are recorded by their first bytes, as in the dependencies
+    // of the graph.
+    if (plasma_trace_start != 0.0) {
+        plasma_trace_dep_t deps[3];
+        int num_deps = 0;
+        for (int i = 0; i < 3; i++) {
+            if (node->access[i] != PlasmaGraphNone) {
+                deps[num_deps].begin = T(node, i);
+                deps[num_deps].end = T(node, i);
+                deps[num_deps].access = node->access[i];
+                num_deps++;
+            }
+        }
+        plasma_trace_task(name, fmas, plasma_trace_start, omp_get_wtime(),
+                          sequence, deps, num_deps);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel replay of a recorded call on descriptors of the same shape.
+ *  Waits for the tasks created before, e.g., translating the matrices,
+ *  then runs the recorded tasks by one OpenMP task per thread, which
+ *  take ready tasks from a shared queue. Each recorded task counts its
+ *  predecessors left, and is queued by the one completing last.
+ *  Returns once all recorded tasks have run.
+ * @see plasma_graph_create
+ ******************************************************************************/
+void plasma_pzgraph(plasma_graph_t *graph, const plasma_desc_t *descs,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    int num_nodes = graph->num_nodes;
+    const plasma_graph_node_t *nodes = graph->nodes;
+    const int *succ = graph->succ;
+
+    int *count = (int*)malloc((size_t)imax(1, num_nodes)*sizeof(int));
+    volatile int *ready =
+        (volatile int*)malloc((size_t)imax(1, num_nodes)*sizeof(int));
+    if (count == NULL || ready == NULL) {
+        free(count);
+        free((int*)ready);
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    // Queue the tasks without predecessors, and mark the other slots empty.
+    int head = 0;
+    int tail = 0;
+    for (int i = 0; i < num_nodes; i++) {
+        count[i] = nodes[i].num_pred;
+        ready[i] = -1;
+    }
+    for (int i = 0; i < num_nodes; i++)
+        if (count[i] == 0)
+            ready[tail++] = i;
+
+    #pragma omp taskwait
+
+    int num_workers = omp_get_num_threads();
+    for (int w = 0; w < num_workers; w++) {
+        #pragma omp task shared(head, tail)
+        {
+            for (;;) {
+                // Claim the next slot of the queue,
+                // and wait for a task to be queued in it.
+                int slot = __sync_fetch_and_add(&head, 1);
+                if (slot >= num_nodes)
+                    break;
+
+                int id;
+                int spins = 0;
+                while ((id = ready[slot]) < 0) {
+                    if (spins < MaxSpins) {
+                        plasma_barrier_pause();
+                        spins++;
+                    }
+                    else {
+                        sched_yield();
+                    }
+                }
+                __sync_synchronize();
+
+                // Tasks skipped after a failure still queue their
+                // successors, so that all slots are filled.
+                const plasma_graph_node_t *node = &nodes[id];
+                plasma_pzgraph_node(node, descs, sequence, request);
+
+                for (int s = node->succ; s < node->succ+node->num_succ; s++) {
+                    if (__sync_sub_and_fetch(&count[succ[s]], 1) == 0) {
+                        int t = __sync_fetch_and_add(&tail, 1);
+                        ready[t] = succ[s];
+                    }
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+
+    free(count);
+    free((int*)ready);
+}
@@ -59,7 +59,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, A(m, k), ldam,
                                        B(k, n), ldbk,
                                 zbeta, C(m, n), ldcm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                         else {
                             if (k == m) {
@@ -78,7 +78,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                     alpha, A(k, m), ldak,
                                            B(k, n), ldbk,
                                     zbeta, C(m, n), ldcm,
-                                    sequence, request);
+                                    0, sequence, request);
                             }
                         }
                     }
@@ -99,7 +99,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, A(k, m), ldak,
                                        B(k, n), ldbk,
                                 zbeta, C(m, n), ldcm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                         else {
                             if (k == m) {
@@ -118,7 +118,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                     alpha, A(m, k), ldam,
                                            B(k, n), ldbk,
                                     zbeta, C(m, n), ldcm,
-                                    sequence, request);
+                                    0, sequence, request);
                             }
                         }
                     }
@@ -142,7 +142,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, B(m, k), ldbm,
                                        A(n, k), ldan,
                                 zbeta, C(m, n), ldcm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                         else {
                             if (n == k) {
@@ -161,7 +161,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                     alpha, B(m, k), ldbm,
                                            A(k, n), ldak,
                                     zbeta, C(m, n), ldcm,
-                                    sequence, request);
+                                    0, sequence, request);
                             }
                         }
                     }
@@ -181,7 +181,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, B(m, k), ldbm,
                                        A(k, n), ldak,
                                 zbeta, C(m, n), ldcm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                         else {
                             if (n == k) {
@@ -200,7 +200,7 @@ void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
                                     alpha, B(m, k), ldbm,
                                            A(n, k), ldan,
                                     zbeta, C(m, n), ldcm,
-                                    sequence, request);
+                                    0, sequence, request);
                             }
                         }
                     }
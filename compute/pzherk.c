@@ -50,7 +50,7 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
                     nvcn, nvak,
                     alpha, A(n, k), ldan,
                     dbeta, C(n, n), ldcn,
-                    sequence, request);
+                    0, sequence, request);
             }
             //==============================
             // PlasmaNoTrans / PlasmaLower
@@ -69,7 +69,7 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(m, k), ldam,
                                    A(n, k), ldan,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -89,7 +89,7 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(n, k), ldan,
                                    A(m, k), ldam,
                             zbeta, C(n, m), ldcn,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -107,7 +107,7 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
                     nvcn, mvak,
                     alpha, A(k, n), ldak,
                     dbeta, C(n, n), ldcn,
-                    sequence, request);
+                    0, sequence, request);
             }
             //===================================
             // Plasma[_ConjTrans] / PlasmaLower
@@ -126,7 +126,7 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(k, m), ldak,
                                    A(k, n), ldak,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -146,7 +146,7 @@ void plasma_pzherk(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(k, n), ldak,
                                    A(k, m), ldak,
                             zbeta, C(n, m), ldcn,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -50,7 +50,6 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
 
     // Read parameters from the context.
     plasma_context_t *plasma = plasma_context_self();
-    plasma_barrier_t *barrier = &plasma->barrier;
     int ib = plasma->ib;
     int max_panel_threads = plasma->max_panel_threads;
     int wmt = W.mt-(1+2*A.mt);
@@ -66,6 +65,10 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
     // NOTE: In old PLASMA, we used priority.
     if (uplo == PlasmaLower) {
         for (int k = 0; k < A.mt; k++) {
+            // Stop creating tasks once the sequence has failed.
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int mvak = plasma_tile_mview(A, k);
             int ldak = plasma_tile_mmain(A, k);
             int ldtk = T.mb; //plasma_tile_mmain_band(T, k);
@@ -80,7 +83,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                     1.0, T(m, m), ldtm,
                          L(k, m), ldak,
                     0.0, H(m, k), A.mb,
-                    sequence, request);
+                    0, sequence, request);
                 if (m > 1) {
                     core_omp_zgemm(
                         PlasmaNoTrans, PlasmaConjTrans,
@@ -88,7 +91,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                         1.0, T(m, m-1), ldtm,
                              L(k, m-1), ldak,
                         1.0, H(m, k),   A.mb,
-                        sequence, request);
+                        0, sequence, request);
                 }
                 int mvamp1 = plasma_tile_mview(A, m+1);
                 int ldtmp1 = A.mb; //plasma_tile_mmain_band(T, m+1);
@@ -98,7 +101,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                     1.0, T(m+1, m), ldtmp1,
                          L(k, m+1), ldak,
                     1.0, H(m, k),   A.mb,
-                    sequence, request);
+                    0, sequence, request);
             }
             // ---- end of computing H(1:(k-1),k) -- //
 
@@ -120,7 +123,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                         -1.0, L(k, m), ldak,
                               H(m, k), A.mb,
                         beta, W3(id),  A.mb,
-                        sequence, request);
+                        0, sequence, request);
                 }
                 // all-reduce W3 using a binary tree                          //
                 // NOTE: Old PLASMA had an option to reduce in a set of tiles //
@@ -179,14 +182,14 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                         1.0, L(k, k),   ldak,
                              T(k, k-1), ldtk,
                         0.0, W(0), A.mb,
-                        sequence, request);
+                        0, sequence, request);
                     core_omp_zgemm(
                         PlasmaNoTrans, PlasmaConjTrans,
                         mvak, mvak, A.mb,
                         -1.0, W(0), A.mb,
                               L(k, k-1), ldak,
                          1.0, T(k, k), ldtk,
-                        sequence, request);
+                        0, sequence, request);
                 }
 
                 // - symmetrically solve with L(k,k) //
@@ -213,7 +216,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                     1.0, T(k, k-1), ldtk,
                          L(k, k-1), ldak,
                     0.0, H(k, k), A.mb,
-                    sequence, request);
+                    0, sequence, request);
                 beta = 1.0;
             }
 
@@ -226,7 +229,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                         1.0,  T(k, k), ldtk,
                               L(k, k), ldak,
                         beta, H(k, k), A.mb,
-                        sequence, request);
+                        0, sequence, request);
 
                     // computing the (k+1)-th column of L //
                     // - update with the previous column
@@ -251,7 +254,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                                         -1.0, L(m, n), ldam,
                                               H(n, k), A.mb,
                                         beta, W4(id),  A.mb,
-                                        sequence, request);
+                                        0, sequence, request);
                                 }
                                 else {
                                     core_omp_zgemm(
@@ -260,7 +263,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                                         -1.0, L(m, n), ldam,
                                               H(n, k), A.mb,
                                         beta, W4(id),  A.mb,
-                                        sequence, request);
+                                        0, sequence, request);
                                 }
                             }
                         }
@@ -311,7 +314,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                                     -1.0, L(m, n), ldam,
                                           H(n, k), A.mb,
                                      1.0, L(m, k+1), ldam,
-                                    sequence, request);
+                                    0, sequence, request);
                             }
                         }
                     }
@@ -339,24 +342,46 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                                  depend(out:ipiv[k1-1:k2]) /*\
                                  priority(1) */
                 {
+                    volatile int *max_idx =
+                        (int*)malloc(max_panel_threads*sizeof(int));
+                    if (max_idx == NULL)
+                        plasma_request_fail(sequence, request,
+                                            PlasmaErrorOutOfMemory);
+
+                    volatile plasma_complex64_t *max_val =
+                        (plasma_complex64_t*)malloc(max_panel_threads*sizeof(
+                                                    plasma_complex64_t));
+                    if (max_val == NULL)
+                        plasma_request_fail(sequence, request,
+                                            PlasmaErrorOutOfMemory);
+
+                    volatile int info = 0;
+
+                    plasma_barrier_t barrier;
+                    plasma_barrier_init(&barrier);
+
                     if (sequence->status == PlasmaSuccess) {
                         for (int rank = 0; rank < max_panel_threads; rank++) {
-                            #pragma omp task // priority(1)
+                            #pragma omp task shared(barrier, info) // priority(1)
                             {
                                 plasma_desc_t view =
                                     plasma_desc_view(A,
                                                      (k+1)*A.mb, k*A.nb,
                                                      mlkk, mvak);
 
-                                int info = core_zgetrf(view, IPIV(k+1), ib,
-                                                       rank, max_panel_threads,
-                                                       barrier);
-                                if (info != 0)
-                                    plasma_request_fail(sequence, request, (k+1)*A.mb+info);
+                                int iinfo = core_zgetrf(view, IPIV(k+1), ib,
+                                                        rank, max_panel_threads,
+                                                        max_idx, max_val, &info,
+                                                        &barrier);
+                                if (iinfo != 0)
+                                    plasma_request_fail(sequence, request, (k+1)*A.mb+iinfo);
                             }
                         }
                     }
                     #pragma omp taskwait
+
+                    free((void*)max_idx);
+                    free((void*)max_val);
                     for (int i = 0; i < imin(mlkk, mvak); i++) {
                         IPIV(k+1)[i] += (k+1)*A.mb;
                     }
@@ -409,7 +434,7 @@ void plasma_pzhetrf_aasen(plasma_enum_t uplo,
                         mvakp1, mvak,
                         1.0, L(k,   k), ldak,
                              T(k+1, k), ldtkp1,
-                        sequence, request);
+                        0, sequence, request);
                 }
                 // copy T(k+1, k) to T(k, k+1) for zgbtrf
                 core_omp_zlacpy(
@@ -38,7 +38,6 @@ void plasma_pzlaset(plasma_enum_t uplo,
     int i, j;
     int m, n;
 
-    int lm1 = A.gm/A.mb;
     int ln1 = A.gn/A.nb;
 
     for (i = 0; i < A.mt; i++) {
@@ -65,7 +64,7 @@ void plasma_pzlaset(plasma_enum_t uplo,
                 (uplo == PlasmaLower && i >= j) ||
                 (uplo == PlasmaUpper && i <= j))
                 core_omp_zlaset(i == j ? uplo : PlasmaGeneral,
-                                A.i/A.mb+i == lm1 ? A.gm-lm1*A.mb : A.mb,
+                                plasma_tile_mmain(A, i),
                                 A.j/A.nb+j == ln1 ? A.gn-ln1*A.nb : A.nb,
                                 i == 0 ? A.i%A.mb : 0,
                                 j == 0 ? A.j%A.nb : 0,
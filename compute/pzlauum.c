@@ -48,7 +48,7 @@ void plasma_pzlauum(plasma_enum_t uplo, plasma_desc_t A,
                     imin(mvan, nvan), imin(mvak, nvan),
                     1.0, A(k, n), ldak,
                     1.0, A(n, n), ldan,
-                    sequence, request);
+                    0, sequence, request);
 
                 for (int m = n+1; m < k; m++) {
                     int mvam = plasma_tile_mview(A, m);
@@ -59,7 +59,7 @@ void plasma_pzlauum(plasma_enum_t uplo, plasma_desc_t A,
                         1.0, A(k, m), ldak,
                              A(k, n), ldak,
                         1.0, A(m, n), ldam,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
             for (int n = 0; n < k; n++) {
@@ -95,7 +95,7 @@ void plasma_pzlauum(plasma_enum_t uplo, plasma_desc_t A,
                     imin(mvam, nvam), imin(mvam, nvak),
                     1.0, A(m, k), ldam,
                     1.0, A(m, m), ldam,
-                    sequence, request);
+                    0, sequence, request);
 
                 for (int n = m+1; n < k; n++) {
                     int nvan = plasma_tile_nview(A, n);
@@ -106,7 +106,7 @@ void plasma_pzlauum(plasma_enum_t uplo, plasma_desc_t A,
                         1.0, A(m, k), ldam,
                              A(n, k), ldan,
                         1.0, A(m, n), ldam,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
             for (int m = 0; m < k; m++) {
@@ -36,13 +36,17 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
         // PlasmaLower
         //==============
         for (int k = 0; k < A.mt; k++) {
+            // Stop creating tasks once the sequence has failed.
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int mvak  = plasma_tile_mview(A, k);
             int ldakk = plasma_tile_mmain_band(A, k, k);
             core_omp_zpotrf(
                 PlasmaLower, mvak,
                 A(k, k), ldakk,
                 A.nb*k,
-                sequence, request);
+                0, sequence, request);
             for (int m = k+1; m < imin(A.nt, k+A.klt); m++) {
                 int mvam  = plasma_tile_mview(A, m);
                 int ldamk = plasma_tile_mmain_band(A, m, k);
@@ -53,13 +57,13 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                     mvam, mvak,
                     1.0, A(k, k), ldakk,
                          A(m, k), ldamk,
-                    sequence, request);
+                    0, sequence, request);
                 core_omp_zherk(
                     PlasmaLower, PlasmaNoTrans,
                     mvam, A.mb,
                     -1.0, A(m, k), ldamk,
                      1.0, A(m, m), ldamm,
-                    sequence, request);
+                    0, sequence, request);
                 for (int n = imax(k+1, m-A.klt); n < m; n++) {
                     int nvan  = plasma_tile_nview(A, n);
                     int ldank = plasma_tile_mmain_band(A, n, k);
@@ -70,7 +74,7 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                         -1.0, A(m, k), ldamk,
                               A(n, k), ldank,
                          1.0, A(m, n), ldamn,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
         }
@@ -80,13 +84,17 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
         // PlasmaUpper
         //==============
         for (int k = 0; k < A.nt; k++) {
+            // Stop creating tasks once the sequence has failed.
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int mvak  = plasma_tile_mview(A, k);
             int ldakk = plasma_tile_mmain_band(A, k, k);
             core_omp_zpotrf(
                 PlasmaUpper, mvak,
                 A(k, k), ldakk,
                 A.nb*k,
-                sequence, request);
+                0, sequence, request);
             for (int m = k+1; m < imin(A.nt, k+A.kut); m++) {
                 int mvam  = plasma_tile_mview(A, m);
                 int ldakm = plasma_tile_mmain_band(A, k, m);
@@ -97,13 +105,13 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                     A.nb, mvam,
                     1.0, A(k, k), ldakk,
                          A(k, m), ldakm,
-                    sequence, request);
+                    0, sequence, request);
                 core_omp_zherk(
                     PlasmaUpper, PlasmaConjTrans,
                     mvam, A.mb,
                     -1.0, A(k, m), ldakm,
                      1.0, A(m, m), ldamm,
-                    sequence, request);
+                    0, sequence, request);
                 for (int n = imax(k+1, m-A.kut); n < m; n++) {
                     int ldakn = plasma_tile_mmain_band(A, k, n);
                     int ldanm = plasma_tile_mmain_band(A, n, m);
@@ -113,7 +121,7 @@ void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                         -1.0, A(k, n), ldakn,
                               A(k, m), ldakm,
                          1.0, A(n, m), ldanm,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
         }
@@ -24,7 +24,7 @@
  *  Parallel tile Cholesky factorization.
  * @see plasma_omp_zpotrf
  ******************************************************************************/
-void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
+void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A, int lookahead,
                     plasma_sequence_t *sequence, plasma_request_t *request)
 {
     // Return if failed sequence.
@@ -36,13 +36,18 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
     //==============
     if (uplo == PlasmaLower) {
         for (int k = 0; k < A.mt; k++) {
+            // Stop creating tasks once the sequence has failed.
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int mvak = plasma_tile_mview(A, k);
             int ldak = plasma_tile_mmain(A, k);
+            int priority_k = plasma_lookahead_priority(lookahead, k, k);
             core_omp_zpotrf(
                 PlasmaLower, mvak,
                 A(k, k), ldak,
                 A.nb*k,
-                sequence, request);
+                priority_k, sequence, request);
 
             for (int m = k+1; m < A.mt; m++) {
                 int mvam = plasma_tile_mview(A, m);
@@ -53,27 +58,29 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     mvam, A.mb,
                     1.0, A(k, k), ldak,
                          A(m, k), ldam,
-                    sequence, request);
+                    priority_k, sequence, request);
             }
             for (int m = k+1; m < A.mt; m++) {
                 int mvam = plasma_tile_mview(A, m);
                 int ldam = plasma_tile_mmain(A, m);
+                int priority_m = plasma_lookahead_priority(lookahead, k, m);
                 core_omp_zherk(
                     PlasmaLower, PlasmaNoTrans,
                     mvam, A.mb,
                     -1.0, A(m, k), ldam,
                      1.0, A(m, m), ldam,
-                    sequence, request);
+                    priority_m, sequence, request);
 
                 for (int n = k+1; n < m; n++) {
                     int ldan = plasma_tile_mmain(A, n);
+                    int priority_n = plasma_lookahead_priority(lookahead, k, n);
                     core_omp_zgemm(
                         PlasmaNoTrans, PlasmaConjTrans,
                         mvam, A.mb, A.mb,
                         -1.0, A(m, k), ldam,
                               A(n, k), ldan,
                          1.0, A(m, n), ldam,
-                        sequence, request);
+                        priority_n, sequence, request);
                 }
             }
         }
@@ -83,13 +90,18 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
     //==============
     else {
         for (int k = 0; k < A.nt; k++) {
+            // Stop creating tasks once the sequence has failed.
+            if (sequence->status != PlasmaSuccess)
+                break;
+
             int nvak = plasma_tile_nview(A, k);
             int ldak = plasma_tile_mmain(A, k);
+            int priority_k = plasma_lookahead_priority(lookahead, k, k);
             core_omp_zpotrf(
                 PlasmaUpper, nvak,
                 A(k, k), ldak,
                 A.nb*k,
-                sequence, request);
+                priority_k, sequence, request);
 
             for (int m = k+1; m < A.nt; m++) {
                 int nvam = plasma_tile_nview(A, m);
@@ -99,27 +111,29 @@ void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     A.nb, nvam,
                     1.0, A(k, k), ldak,
                          A(k, m), ldak,
-                    sequence, request);
+                    priority_k, sequence, request);
             }
             for (int m = k+1; m < A.nt; m++) {
                 int nvam = plasma_tile_nview(A, m);
                 int ldam = plasma_tile_mmain(A, m);
+                int priority_m = plasma_lookahead_priority(lookahead, k, m);
                 core_omp_zherk(
                     PlasmaUpper, PlasmaConjTrans,
                     nvam, A.mb,
                     -1.0, A(k, m), ldak,
                      1.0, A(m, m), ldam,
-                    sequence, request);
+                    priority_m, sequence, request);
 
                 for (int n = k+1; n < m; n++) {
                     int ldan = plasma_tile_mmain(A, n);
+                    int priority_n = plasma_lookahead_priority(lookahead, k, n);
                     core_omp_zgemm(
                         PlasmaConjTrans, PlasmaNoTrans,
                         A.mb, nvam, A.mb,
                         -1.0, A(k, n), ldak,
                               A(k, m), ldak,
                          1.0, A(n, m), ldan,
-                        sequence, request);
+                        priority_n, sequence, request);
                 }
             }
         }
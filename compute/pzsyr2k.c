@@ -73,14 +73,14 @@ void plasma_pzsyr2k(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(m, k), ldam,
                                    B(n, k), ldbn,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                         core_omp_zgemm(
                             trans, PlasmaTrans,
                             mvcm, nvcn, nvak,
                             alpha, B(m, k), ldam,
                                    A(n, k), ldan,
                             1.0,   C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -101,14 +101,14 @@ void plasma_pzsyr2k(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(n, k), ldan,
                                    B(m, k), ldbm,
                             zbeta, C(n, m), ldcn,
-                            sequence, request);
+                            0, sequence, request);
                         core_omp_zgemm(
                             trans, PlasmaTrans,
                             nvcn, mvcm, nvak,
                             alpha, B(n, k), ldan,
                                    A(m, k), ldam,
                             1.0,   C(n, m), ldcn,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -148,14 +148,14 @@ void plasma_pzsyr2k(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(k, m), ldak,
                                    B(k, n), ldbk,
                             zbeta, C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                         core_omp_zgemm(
                             trans, PlasmaNoTrans,
                             mvcm, nvcn, mvak,
                             alpha, B(k, m), ldbk,
                                    A(k, n), ldak,
                             1.0,   C(m, n), ldcm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -176,14 +176,14 @@ void plasma_pzsyr2k(plasma_enum_t uplo, plasma_enum_t trans,
                             alpha, A(k, n), ldak,
                                    B(k, m), ldbk,
                             zbeta, C(n, m), ldcn,
-                            sequence, request);
+                            0, sequence, request);
                         core_omp_zgemm(
                             trans, PlasmaNoTrans,
                             nvcn, mvcm, mvak,
                             alpha, B(k, n), ldbk,
                                    A(k, m), ldak,
                             1.0,   C(n, m), ldcn,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
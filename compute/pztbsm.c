@@ -53,7 +53,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(B.mt-k-1, B.mt-k-1), ldak,
                                     B(B.mt-k-1,        n), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = imax(0, (B.mt-k-1)-A.kut+1); m < B.mt-k-1; m++) {
                         int ldam = plasma_tile_mmain_band(A, m, B.mt-k-1);
@@ -66,7 +66,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(m, B.mt-k-1), ldam,
                                         B(B.mt-k-1, n), ldbk,
                                 lalpha, B(m, n       ), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -87,7 +87,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(k, k), ldak,
                                     B(k, n), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = k+1; m < imin(A.mt, k+A.kut); m++) {
                         int mvbm = plasma_tile_mview(B, m);
@@ -101,7 +101,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(k, m), ldam,
                                         B(k, n), ldbk,
                                 lalpha, B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -135,7 +135,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(k, k), ldak,
                                     B(k, n), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = k+1; m < imin(k+A.klt, A.mt); m++) {
                         int mvbm = plasma_tile_mview(B, m);
@@ -149,7 +149,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(m, k), ldam,
                                         B(k, n), ldbk,
                                 lalpha, B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -175,7 +175,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(m, B.mt-k-1), ldam,
                                         B(m, n       ), ldbm,
                                 lalpha, B(B.mt-k-1, n), ldbk,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                     for (int n = 0; n < B.nt; n++) {
@@ -185,7 +185,7 @@ void plasma_pztbsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(B.mt-k-1, B.mt-k-1), ldak,
                                     B(B.mt-k-1,        n), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                         if (ipiv != NULL) {
                             int k1 = 1+(B.mt-k-1)*A.nb;
                             int k2 = k1+mvbk-1;
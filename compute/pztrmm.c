@@ -63,7 +63,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, A(m, k), ldam,
                                        B(k, n), ldbk,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -94,7 +94,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, A(k, m), ldak,
                                        B(k, n), ldbk,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -126,7 +126,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, A(m, k), ldam,
                                        B(k, n), ldbk,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -158,7 +158,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, A(k, m), ldak,
                                        B(k, n), ldbk,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -192,7 +192,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, B(m, k), ldbm,
                                        A(k, n), ldak,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -222,7 +222,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, B(m, k), ldbm,
                                        A(n, k), ldan,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -255,7 +255,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, B(m, k), ldbm,
                                        A(k, n), ldak,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -284,7 +284,7 @@ void plasma_pztrmm(plasma_enum_t side, plasma_enum_t uplo,
                                 alpha, B(m, k), ldbm,
                                        A(n, k), ldan,
                                 1.0,   B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -53,7 +53,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(B.mt-k-1, B.mt-k-1), ldak,
                                     B(B.mt-k-1, n       ), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int ldam = plasma_tile_mmain(A, B.mt-1-m);
@@ -66,7 +66,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(B.mt-1-m, B.mt-k-1), ldam,
                                         B(B.mt-k-1, n       ), ldbk,
                                 lalpha, B(B.mt-1-m, n       ), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -87,7 +87,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(k, k), ldak,
                                     B(k, n), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
@@ -100,7 +100,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(k, m), ldak,
                                         B(k, n), ldbk,
                                 lalpha, B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -123,7 +123,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(k, k), ldak,
                                     B(k, n), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
@@ -137,7 +137,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(m, k), ldam,
                                         B(k, n), ldbk,
                                 lalpha, B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -158,7 +158,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbk, nvbn,
                             lalpha, A(B.mt-k-1, B.mt-k-1), ldak,
                                     B(B.mt-k-1, n       ), ldbk,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = k+1; m < B.mt; m++) {
                         int ldbm = plasma_tile_mmain(B, B.mt-1-m);
@@ -170,7 +170,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   A(B.mt-k-1, B.mt-1-m), ldak,
                                         B(B.mt-k-1, n       ), ldbk,
                                 lalpha, B(B.mt-1-m, n       ), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -195,7 +195,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbm, nvbk,
                             lalpha, A(k, k), ldak,
                                     B(m, k), ldbm,
-                            sequence, request);
+                            0, sequence, request);
                     }
                     for (int m = 0; m < B.mt; m++) {
                         int mvbm = plasma_tile_mview(B, m);
@@ -208,7 +208,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   B(m, k), ldbm,
                                         A(k, n), ldak,
                                 lalpha, B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -228,7 +228,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbm, nvbk,
                             alpha, A(B.nt-k-1, B.nt-k-1), ldak,
                                    B(m,        B.nt-k-1), ldbm,
-                            sequence, request);
+                            0, sequence, request);
 
                         for (int n = k+1; n < B.nt; n++) {
                             int ldan = plasma_tile_mmain(A, B.nt-1-n);
@@ -238,7 +238,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0/alpha, B(m,        B.nt-k-1), ldbm,
                                             A(B.nt-1-n, B.nt-k-1), ldan,
                                 1.0,        B(m,        B.nt-1-n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -261,7 +261,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbm, nvbk,
                             lalpha, A(B.nt-k-1, B.nt-k-1), ldak,
                                     B(m,        B.nt-k-1), ldbm,
-                            sequence, request);
+                            0, sequence, request);
 
                         for (int n = k+1; n < B.nt; n++) {
                             core_omp_zgemm(
@@ -270,7 +270,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0,   B(m,        B.nt-k-1), ldbm,
                                         A(B.nt-1-k, B.nt-1-n), ldak,
                                 lalpha, B(m,        B.nt-1-n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
@@ -290,7 +290,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                             mvbm, nvbk,
                             alpha, A(k, k), ldak,
                                    B(m, k), ldbm,
-                            sequence, request);
+                            0, sequence, request);
 
                         for (int n = k+1; n < B.nt; n++) {
                             int nvbn = plasma_tile_nview(B, n);
@@ -301,7 +301,7 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                 -1.0/alpha, B(m, k), ldbm,
                                             A(n, k), ldan,
                                 1.0,        B(m, n), ldbm,
-                                sequence, request);
+                                0, sequence, request);
                         }
                     }
                 }
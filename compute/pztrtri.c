@@ -48,7 +48,7 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     mvam, nvak,
                     -1.0, A(k, k), ldak,
                           A(m, k), ldam,
-                    sequence, request);
+                    0, sequence, request);
             }
             for (int m = k+1; m < A.mt; m++) {
                 int mvam = plasma_tile_mview(A, m);
@@ -61,7 +61,7 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                         1.0, A(m, k), ldam,
                              A(k, n), ldak,
                         1.0, A(m, n), ldam,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
             for (int n = 0; n < k; n++) {
@@ -71,7 +71,7 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     mvak, nvan,
                     1.0, A(k, k), ldak,
                          A(k, n), ldak,
-                    sequence, request);
+                    0, sequence, request);
             }
             core_omp_ztrtri(
                 uplo, diag,
@@ -96,7 +96,7 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                     mvak, nvan,
                     -1.0, A(k, k), ldak,
                           A(k, n), ldak,
-                    sequence, request);
+                    0, sequence, request);
             }
             for (int m = 0; m < k; m++) {
                 int mvam = plasma_tile_mview(A, m);
@@ -109,14 +109,14 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                         1.0, A(m, k), ldam,
                              A(k, n), ldak,
                         1.0, A(m, n), ldam,
-                        sequence, request);
+                        0, sequence, request);
                 }
                 core_omp_ztrsm(
                     PlasmaRight, uplo, PlasmaNoTrans, diag,
                     mvam, nvak,
                     1.0, A(k, k), ldak,
                          A(m, k), ldam,
-                    sequence, request);
+                    0, sequence, request);
             }
             core_omp_ztrtri(
                 uplo, diag,
@@ -56,7 +56,7 @@ void plasma_pzungqr(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     A(m, k), ldam,
                     T(m, k), T.mb,
                     work,
-                    sequence, request);
+                    0, sequence, request);
             }
         }
         for (int n = k; n < Q.nt; n++) {
@@ -68,7 +68,7 @@ void plasma_pzungqr(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                 T(k, k), T.mb,
                 Q(k, n), ldqk,
                 work,
-                sequence, request);
+                0, sequence, request);
         }
     }
 }
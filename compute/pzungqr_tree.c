@@ -66,7 +66,7 @@ void plasma_pzungqr_tree(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                                 T(k, j), T.mb,
                                 Q(k, n), ldqk,
                                 work,
-                                sequence, request);
+                                0, sequence, request);
             }
         }
         else if (kernel == PlasmaTtKernel) {
@@ -106,7 +106,7 @@ void plasma_pzungqr_tree(plasma_desc_t A, plasma_desc_t T, plasma_desc_t Q,
                     A(k,    j), ldak,
                     T2(k,   j), T.mb,
                     work,
-                    sequence, request);
+                    0, sequence, request);
             }
         }
         else {
@@ -58,7 +58,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                         T(k, k), T.mb,
                         B(k, n), ldbk,
                         work,
-                        sequence, request);
+                        0, sequence, request);
                 }
                 for (int m = k+1; m < B.mt; m++) {
                     int mvbm = plasma_tile_mview(B, m);
@@ -74,7 +74,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                             A(m, k), ldam,
                             T(m, k), T.mb,
                             work,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
@@ -103,7 +103,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                             A(m, k), ldam,
                             T(m, k), T.mb,
                             work,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
                 for (int n = 0; n < B.nt; n++) {
@@ -115,7 +115,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                         T(k, k), T.mb,
                         B(k, n), ldbk,
                         work,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
         }
@@ -144,7 +144,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                             A(n, k), ldan,
                             T(n, k), T.mb,
                             work,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
                 for (int m = 0; m < B.mt; m++) {
@@ -157,7 +157,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                         T(k, k), T.mb,
                         B(m, k), ldbm,
                         work,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
         }
@@ -180,7 +180,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                         T(k, k), T.mb,
                         B(m, k), ldbm,
                         work,
-                        sequence, request);
+                        0, sequence, request);
                 }
                 for (int n = k+1; n < B.nt; n++) {
                     int nvbn = plasma_tile_nview(B, n);
@@ -196,7 +196,7 @@ void plasma_pzunmqr(plasma_enum_t side, plasma_enum_t trans,
                             A(n, k), ldan,
                             T(n, k), T.mb,
                             work,
-                            sequence, request);
+                            0, sequence, request);
                     }
                 }
             }
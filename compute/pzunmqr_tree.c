@@ -81,7 +81,7 @@ void plasma_pzunmqr_tree(plasma_enum_t side, plasma_enum_t trans,
                                     T(k, j), T.mb,
                                     B(k, n), ldbk,
                                     work,
-                                    sequence, request);
+                                    0, sequence, request);
                 }
             }
             else if (kernel == PlasmaTtKernel) {
@@ -121,7 +121,7 @@ void plasma_pzunmqr_tree(plasma_enum_t side, plasma_enum_t trans,
                         A(k,    j), ldak,
                         T2(k,   j), T.mb,
                         work,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
             else {
@@ -167,7 +167,7 @@ void plasma_pzunmqr_tree(plasma_enum_t side, plasma_enum_t trans,
                         T(k, j), T.mb,
                         B(m, k), ldbm,
                         work,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
             else if (kernel == PlasmaTtKernel) {
@@ -205,7 +205,7 @@ void plasma_pzunmqr_tree(plasma_enum_t side, plasma_enum_t trans,
                         A(k,  j), ldak,
                         T2(k, j), T.mb,
                         work,
-                        sequence, request);
+                        0, sequence, request);
                 }
             }
             else {
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -143,6 +144,10 @@ int plasma_zcgesv(int n, int nrhs,
         return PlasmaSuccess;
 
     // Set tiling parameters
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "gesv_mixed", PlasmaComplexDouble, n, n, nrhs);
+
     int nb = plasma->nb;
 
     // Create tile matrices
@@ -163,10 +168,11 @@ int plasma_zcgesv(int n, int nrhs,
         plasma_desc_destroy(&A);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &X);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pX, ldx,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &X);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         plasma_desc_destroy(&B);
         return retval;
@@ -222,9 +228,6 @@ int plasma_zcgesv(int n, int nrhs,
     // Initialize request
     plasma_request_t request = PlasmaRequestInitializer;
 
-    // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
-
     // Asynchronous block
     #pragma omp parallel
     #pragma omp master
@@ -416,7 +419,8 @@ void plasma_omp_zcgesv(plasma_desc_t A,  int *ipiv,
 
     // Compute the LU factorization of As.
     #pragma omp taskwait
-    plasma_pcgetrf(As, ipiv, sequence, request);
+    plasma_pcgetrf(As, ipiv, plasma->ib, plasma->max_panel_threads,
+                   plasma->lookahead, sequence, request);
 
     // Solve the system As * Xs = Bs.
     #pragma omp taskwait
@@ -505,7 +509,8 @@ void plasma_omp_zcgesv(plasma_desc_t A,  int *ipiv,
 
     // Compute LU factorization of A.
     #pragma omp taskwait
-    plasma_pzgetrf(A, ipiv, sequence, request);
+    plasma_pzgetrf(A, ipiv, plasma->ib, plasma->max_panel_threads,
+                   plasma->lookahead, sequence, request);
 
     // Solve the system A * X = B.
     plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, X, sequence, request);
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "core_lapack.h"
 
@@ -156,6 +157,10 @@ int plasma_zcposv(plasma_enum_t uplo, int n, int nrhs,
         return PlasmaSuccess;
 
     // Set tiling parameters
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "posv_mixed", PlasmaComplexDouble, n, n, nrhs);
+
     int nb = plasma->nb;
 
     // Create tile matrices
@@ -176,10 +181,11 @@ int plasma_zcposv(plasma_enum_t uplo, int n, int nrhs,
         plasma_desc_destroy(&A);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &X);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pX, ldx,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &X);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         plasma_desc_destroy(&B);
         return retval;
@@ -431,7 +437,7 @@ void plasma_omp_zcposv(plasma_enum_t uplo,
     plasma_pzlag2c(A, As, sequence, request);
 
     // Compute the Cholesky factorization of As.
-    plasma_pcpotrf(uplo, As, sequence, request);
+    plasma_pcpotrf(uplo, As, plasma->lookahead, sequence, request);
 
     // Solve the system As * Xs = Bs.
     plasma_pctrsm(PlasmaLeft, uplo,
@@ -514,7 +520,7 @@ void plasma_omp_zcposv(plasma_enum_t uplo,
     *iter = -itermax - 1;
 
     // Compute Cholesky factorization of A.
-    plasma_pzpotrf(uplo, A, sequence, request);
+    plasma_pzpotrf(uplo, A, plasma->lookahead, sequence, request);
 
     // Solve the system A * X = B.
     plasma_pzlacpy(PlasmaGeneral, PlasmaNoTrans, B, X, sequence, request);
@@ -21,7 +21,8 @@
     @ingroup plasma_ccrb2cm
 
     Convert tiled (CCRB) to column-major (CM) matrix layout.
-    Out-of-place.
+    Out-of-place, or in place if A was created for pA by
+    plasma_desc_general_inplace_create() with PlasmaInplace.
 */
 void plasma_omp_zdesc2ge(plasma_desc_t A,
                          plasma_complex64_t *pA, int lda,
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -100,12 +101,13 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
     if (imin(n, nrhs) == 0)
        return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "gbsv", PlasmaComplexDouble, n, n, nrhs);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
-
     // Create tile matrix.
     plasma_desc_t AB;
     plasma_desc_t B;
@@ -121,10 +123,11 @@ int plasma_zgbsv(int n, int kl, int ku, int nrhs,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&AB);
         return retval;
     }
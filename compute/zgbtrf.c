@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -84,12 +85,13 @@ int plasma_zgbtrf(int m, int n, int kl, int ku,
 
     // quick return
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "gbtrf", PlasmaComplexDouble, m, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
-
     // Create tile matrix.
     plasma_desc_t AB;
     int tku = (ku+kl+nb-1)/nb; // number of tiles in upper band (not including diagonal)
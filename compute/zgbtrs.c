@@ -144,10 +144,11 @@ int plasma_zgbtrs(plasma_enum_t trans, int n, int kl, int ku, int nrhs,
         plasma_error("plasma_desc_general_band_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&AB);
         return retval;
     }
@@ -21,7 +21,8 @@
     @ingroup plasma_cm2ccrb
 
     Convert column-major (CM) to tiled (CCRB) matrix layout.
-    Out-of-place.
+    Out-of-place, or in place if A was created for pA by
+    plasma_desc_general_inplace_create() with PlasmaInplace.
 */
 void plasma_omp_zge2desc(plasma_complex64_t *pA, int lda,
                          plasma_desc_t A,
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -147,23 +148,27 @@ int plasma_zgeadd(plasma_enum_t transa,
     if (m == 0 || n == 0 || (alpha == 0.0 && beta == 1.0))
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "geadd", PlasmaComplexDouble, m, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Create tile matrices.
+    // Create descriptors of the LAPACK arrays.
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, lda,
+                                             nb, nb, am, an, 0, 0, am, an, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_lapack_init() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, ldb,
+                                             nb, nb, bm, bn, 0, 0, bm, bn, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_lapack_init() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -183,23 +188,15 @@ int plasma_zgeadd(plasma_enum_t transa,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
-
         // Call tile async function.
         plasma_omp_zgeadd(transa,
                           alpha,     A,
                           beta,      B,
                           sequence, &request);
-
-        // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
     }
     // implicit synchronization
 
-    // Free matrices in tile layout.
+    // Destroy the descriptors.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
 
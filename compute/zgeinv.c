@@ -88,22 +88,19 @@ int plasma_zgeinv(int m, int n, plasma_complex64_t *pA, int lda, int *ipiv)
 
     // Tune parameters.
     if (plasma->tuning)
-        plasma_tune_geinv(plasma, PlasmaComplexDouble, m, n);
+        plasma_tune(plasma, "geinv", PlasmaComplexDouble, m, n, 0);
 
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
-
     // Create tile matrix.
     plasma_desc_t A;
     plasma_desc_t W;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                           m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -235,7 +232,8 @@ void plasma_omp_zgeinv(plasma_desc_t A, int *ipiv, plasma_desc_t W,
     }
 
     // Factorize A.
-    plasma_pzgetrf(A, ipiv, sequence, request);
+    plasma_pzgetrf(A, ipiv, plasma->ib, plasma->max_panel_threads,
+                   plasma->lookahead, sequence, request);
 
     // Need to synchronize here because ipiv has to be completed
     // before starting row permutations.
@@ -150,9 +150,9 @@ int plasma_zgels(plasma_enum_t trans,
     // Tune parameters.
     if (plasma->tuning) {
         if (m < n)
-	        plasma_tune_gelqf(plasma, PlasmaComplexDouble, m, n);
+            plasma_tune(plasma, "gelqf", PlasmaComplexDouble, m, n, 0);
         else
-	        plasma_tune_geqrf(plasma, PlasmaComplexDouble, m, n);
+            plasma_tune(plasma, "geqrf", PlasmaComplexDouble, m, n, 0);
     }
 
     // Set tiling parameters.
@@ -164,18 +164,18 @@ int plasma_zgels(plasma_enum_t trans,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        imax(m, n), nrhs, 0, 0, imax(m, n),
-                                        nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, imax(m, n), nrhs, 0, 0,
+                                                imax(m, n), nrhs, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -187,12 +187,12 @@ int plasma_zgels(plasma_enum_t trans,
         return retval;
     }
 
-    // Allocate workspace.
-    plasma_workspace_t work;
+    // Prepare workspace.
     size_t lwork = nb + ib*nb;  // geqrt/gelqt: tau + work
-    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    retval = plasma_workspace_reserve(&plasma->work, lwork,
+                                      PlasmaComplexDouble);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_workspace_create() failed");
+        plasma_error("plasma_workspace_reserve() failed");
         return retval;
     }
 
@@ -218,7 +218,7 @@ int plasma_zgels(plasma_enum_t trans,
         // Call the tile async function.
         plasma_omp_zgels(PlasmaNoTrans,
                          A, *T,
-                         B, work,
+                         B, plasma->work,
                          sequence, &request);
 
         // Translate back to LAPACK layout.
@@ -227,8 +227,6 @@ int plasma_zgels(plasma_enum_t trans,
     }
     // implicit synchronization
 
-    plasma_workspace_destroy(&work);
-
     // Free matrices in tile layout.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
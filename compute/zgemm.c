@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -176,34 +177,49 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     if (m == 0 || n == 0 || ((alpha == 0.0 || k == 0) && beta == 1.0))
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "gemm", PlasmaComplexDouble, m, n, k);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Create tile matrices.
+    // Create tile matrices. With PlasmaInplace, create descriptors of the
+    // LAPACK arrays instead, which are then operated on without copies.
     plasma_desc_t A;
     plasma_desc_t B;
     plasma_desc_t C;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        return retval;
+    if (plasma->inplace_outplace == PlasmaInplace) {
+        plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, lda,
+                                        nb, nb, am, an, 0, 0, am, an, &A);
+        plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, ldb,
+                                        nb, nb, bm, bn, 0, 0, bm, bn, &B);
+        plasma_desc_general_lapack_init(PlasmaComplexDouble, pC, ldc,
+                                        nb, nb, m, n, 0, 0, m, n, &C);
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
-        return retval;
-    }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &C);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
-        plasma_desc_destroy(&B);
-        return retval;
+    else {
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            am, an, 0, 0, am, an, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            return retval;
+        }
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            bm, bn, 0, 0, bm, bn, &B);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&A);
+            return retval;
+        }
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &C);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&A);
+            plasma_desc_destroy(&B);
+            return retval;
+        }
     }
 
     // Create sequence.
@@ -221,7 +237,7 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout.
+        // Translate to tile layout, if the matrices are tiled.
         plasma_omp_zge2desc(pA, lda, A, sequence, &request);
         plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
         plasma_omp_zge2desc(pC, ldc, C, sequence, &request);
@@ -0,0 +1,258 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#include <omp.h>
+
+/******************************************************************************/
+// Runs a batch of matrix-matrix products. Problem i takes its dimensions
+// from index i*inc of the arrays, so that inc = 0 gives a fixed-size batch.
+static int zgemm_batch(plasma_enum_t transa, plasma_enum_t transb,
+                       const int *m, const int *n, const int *k,
+                       plasma_complex64_t alpha,
+                       plasma_complex64_t **pA, const int *lda,
+                       plasma_complex64_t **pB, const int *ldb,
+                       plasma_complex64_t beta,
+                       plasma_complex64_t **pC, const int *ldc,
+                       int batch, int inc)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((transa != PlasmaNoTrans) &&
+        (transa != PlasmaTrans) &&
+        (transa != PlasmaConjTrans)) {
+        plasma_error("illegal value of transa");
+        return -1;
+    }
+    if ((transb != PlasmaNoTrans) &&
+        (transb != PlasmaTrans) &&
+        (transb != PlasmaConjTrans)) {
+        plasma_error("illegal value of transb");
+        return -2;
+    }
+    if (batch < 0) {
+        plasma_error("illegal value of batch");
+        return -14;
+    }
+    int num = inc == 0 ? imin(batch, 1) : batch;
+    double flops = 0.0;
+    for (int i = 0; i < num; i++) {
+        if (m[i] < 0) {
+            plasma_error("illegal value of m");
+            return -3;
+        }
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -4;
+        }
+        if (k[i] < 0) {
+            plasma_error("illegal value of k");
+            return -5;
+        }
+        int am = transa == PlasmaNoTrans ? m[i] : k[i];
+        int bm = transb == PlasmaNoTrans ? k[i] : n[i];
+        if (lda[i] < imax(1, am)) {
+            plasma_error("illegal value of lda");
+            return -8;
+        }
+        if (ldb[i] < imax(1, bm)) {
+            plasma_error("illegal value of ldb");
+            return -10;
+        }
+        if (ldc[i] < imax(1, m[i])) {
+            plasma_error("illegal value of ldc");
+            return -13;
+        }
+        flops += 2.0*m[i]*n[i]*k[i];
+    }
+
+    // quick return
+    if (batch == 0)
+        return PlasmaSuccess;
+
+    // Run groups of problems as tasks, without translation to tile layout.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        int group = plasma_batch_group(batch, flops/num, omp_get_num_threads());
+        for (int first = 0; first < batch; first += group) {
+            int last = imin(first+group, batch);
+            #pragma omp task
+            {
+                for (int i = first; i < last; i++) {
+                    int j = i*inc;
+                    core_zgemm(transa, transb,
+                               m[j], n[j], k[j],
+                               alpha, pA[i], lda[j],
+                                      pB[i], ldb[j],
+                               beta,  pC[i], ldc[j]);
+                }
+            }
+        }
+    }
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs the matrix-matrix operations
+ *
+ *          \f[ C_i = \alpha [op( A_i )\times op( B_i )] + \beta C_i, \f]
+ *
+ *  for a batch of independent problems of the same size, each small enough
+ *  to be computed by one thread. The problems are computed in one parallel
+ *  region, directly on the arrays, without translation to tile layout.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A_i are not transposed,
+ *          - PlasmaTrans:     A_i are transposed,
+ *          - PlasmaConjTrans: A_i are conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B_i are not transposed,
+ *          - PlasmaTrans:     B_i are transposed,
+ *          - PlasmaConjTrans: B_i are conjugate transposed.
+ *
+ * @param[in] m
+ *          The number of rows of the matrices op( A_i ) and C_i. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices op( B_i ) and C_i. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrices op( A_i ) and the number of
+ *          rows of the matrices op( B_i ). k >= 0.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] pA
+ *          Array of batch pointers to lda-by-ka matrices, where ka is k when
+ *          transa = PlasmaNoTrans, and is m otherwise.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i.
+ *          When transa = PlasmaNoTrans, lda >= max(1,m),
+ *          otherwise, lda >= max(1,k).
+ *
+ * @param[in] pB
+ *          Array of batch pointers to ldb-by-kb matrices, where kb is n when
+ *          transb = PlasmaNoTrans, and is k otherwise.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B_i.
+ *          When transb = PlasmaNoTrans, ldb >= max(1,k),
+ *          otherwise, ldb >= max(1,n).
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ * @param[in,out] pC
+ *          Array of batch pointers to ldc-by-n matrices. On exit, C_i are
+ *          overwritten by the m-by-n matrices
+ *          ( alpha*op( A_i )*op( B_i ) + beta*C_i ).
+ *
+ * @param[in] ldc
+ *          The leading dimension of the arrays C_i. ldc >= max(1,m).
+ *
+ * @param[in] batch
+ *          The number of problems. batch >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgemm_vbatch
+ * @sa plasma_zgemm
+ * @sa plasma_cgemm_batch
+ * @sa plasma_dgemm_batch
+ * @sa plasma_sgemm_batch
+ *
+ ******************************************************************************/
+int plasma_zgemm_batch(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       plasma_complex64_t alpha,
+                       plasma_complex64_t **pA, int lda,
+                       plasma_complex64_t **pB, int ldb,
+                       plasma_complex64_t beta,
+                       plasma_complex64_t **pC, int ldc,
+                       int batch)
+{
+    return zgemm_batch(transa, transb,
+                       &m, &n, &k,
+                       alpha, pA, &lda,
+                              pB, &ldb,
+                       beta,  pC, &ldc,
+                       batch, 0);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gemm
+ *
+ *  Performs the matrix-matrix operations
+ *
+ *          \f[ C_i = \alpha [op( A_i )\times op( B_i )] + \beta C_i, \f]
+ *
+ *  for a batch of independent problems of varying sizes.
+ *  Same as plasma_zgemm_batch, except that m, n, k, lda, ldb and ldc are
+ *  arrays of batch elements, one for each problem.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *             for some problem
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgemm_batch
+ * @sa plasma_cgemm_vbatch
+ * @sa plasma_dgemm_vbatch
+ * @sa plasma_sgemm_vbatch
+ *
+ ******************************************************************************/
+int plasma_zgemm_vbatch(plasma_enum_t transa, plasma_enum_t transb,
+                        const int *m, const int *n, const int *k,
+                        plasma_complex64_t alpha,
+                        plasma_complex64_t **pA, const int *lda,
+                        plasma_complex64_t **pB, const int *ldb,
+                        plasma_complex64_t beta,
+                        plasma_complex64_t **pC, const int *ldc,
+                        int batch)
+{
+    return zgemm_batch(transa, transb,
+                       m, n, k,
+                       alpha, pA, lda,
+                              pB, ldb,
+                       beta,  pC, ldc,
+                       batch, 1);
+}
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -98,6 +99,10 @@ int plasma_zgeqrf(int m, int n,
     if (imin(m, n) == 0)
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "geqrf", PlasmaComplexDouble, m, n, 0);
+
     // Set tiling parameters.
     int ib = plasma->ib;
     int nb = plasma->nb;
@@ -106,10 +111,10 @@ int plasma_zgeqrf(int m, int n,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -120,12 +125,12 @@ int plasma_zgeqrf(int m, int n,
         return retval;
     }
 
-    // Allocate workspace.
-    plasma_workspace_t work;
+    // Prepare workspace.
     size_t lwork = nb + ib*nb;  // geqrt: tau + work
-    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    retval = plasma_workspace_reserve(&plasma->work, lwork,
+                                      PlasmaComplexDouble);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_workspace_create() failed");
+        plasma_error("plasma_workspace_reserve() failed");
         return retval;
     }
 
@@ -148,15 +153,13 @@ int plasma_zgeqrf(int m, int n,
         plasma_omp_zge2desc(pA, lda, A, sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_zgeqrf(A, *T, work, sequence, &request);
+        plasma_omp_zgeqrf(A, *T, plasma->work, sequence, &request);
 
         // Translate back to LAPACK layout.
         plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
     }
     // implicit synchronization
 
-    plasma_workspace_destroy(&work);
-
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
 
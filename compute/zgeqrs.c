@@ -120,20 +120,21 @@ int plasma_zgeqrs(int m, int n, int nrhs,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, nrhs, 0, 0, m, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, m, nrhs, 0, 0, m, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
 
-    // Allocate workspace.
-    plasma_workspace_t work;
+    // Prepare workspace.
     size_t lwork = ib*nb;  // unmqr: work
-    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    retval = plasma_workspace_reserve(&plasma->work, lwork,
+                                      PlasmaComplexDouble);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_workspace_create() failed");
+        plasma_error("plasma_workspace_reserve() failed");
         return retval;
     }
 
@@ -157,15 +158,13 @@ int plasma_zgeqrs(int m, int n, int nrhs,
         plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_zgeqrs(A, T, B, work, sequence, &request);
+        plasma_omp_zgeqrs(A, T, B, plasma->work, sequence, &request);
 
         // Translate back to LAPACK layout.
         plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
     }
     // implicit synchronization
 
-    plasma_workspace_destroy(&work);
-
     // Free matrices in tile layout.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
@@ -15,6 +15,8 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_runtime.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -55,26 +57,28 @@ int plasma_zgesv(int n, int nrhs,
     if (imin(n, nrhs) == 0)
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "gesv", PlasmaComplexDouble, n, n, nrhs);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
-
     // Create tile matrix.
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -89,26 +93,21 @@ int plasma_zgesv(int n, int nrhs,
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
+    // Translation, solve and translation back form one task graph.
+    // Columns of A and B are translated as whole columns, since
+    // plasma_pzgetrf() and plasma_pzgeswp() track dependencies by column.
     #pragma omp parallel
     #pragma omp master
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
-    }
+        plasma_pzge2desc_col(pA, lda, A, sequence, &request);
+        plasma_pzge2desc_col(pB, ldb, B, sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Call the tile async function.
         plasma_omp_zgesv(A, ipiv, B, sequence, &request);
-    }
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
+        plasma_pzdesc2ge_col(A, pA, lda, sequence, &request);
         plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
     }
 
@@ -122,6 +121,192 @@ int plasma_zgesv(int n, int nrhs,
     return status;
 }
 
+/******************************************************************************/
+// Arguments of plasma_zgesv_async(), kept until the solve completes.
+typedef struct {
+    plasma_job_t job;
+    plasma_complex64_t *pA;
+    int lda;
+    int *ipiv;
+    plasma_complex64_t *pB;
+    int ldb;
+    plasma_desc_t A;
+    plasma_desc_t B;
+} zgesv_job_t;
+
+/******************************************************************************/
+static void zgesv_run(plasma_job_t *job)
+{
+    zgesv_job_t *args = (zgesv_job_t*)job;
+
+    // Translate to tile layout.
+    plasma_pzge2desc_col(args->pA, args->lda, args->A,
+                         job->sequence, &job->request);
+    plasma_pzge2desc_col(args->pB, args->ldb, args->B,
+                         job->sequence, &job->request);
+
+    // Solve with the tuning of the submission, as plasma_omp_zgesv()
+    // would with that of the context.
+    plasma_pzgetrf(args->A, args->ipiv, job->ib, job->max_panel_threads,
+                   job->lookahead, job->sequence, &job->request);
+
+    // ipiv has to be completed before the row permutations.
+    #pragma omp taskwait
+
+    plasma_pzgeswp(PlasmaRowwise, args->B, args->ipiv, 1,
+                   job->sequence, &job->request);
+
+    plasma_pztrsm(PlasmaLeft, PlasmaLower, PlasmaNoTrans, PlasmaUnit,
+                  1.0, args->A,
+                       args->B,
+                  job->sequence, &job->request);
+
+    plasma_pztrsm(PlasmaLeft, PlasmaUpper, PlasmaNoTrans, PlasmaNonUnit,
+                  1.0, args->A,
+                       args->B,
+                  job->sequence, &job->request);
+
+    // Translate back to LAPACK layout.
+    plasma_pzdesc2ge_col(args->A, args->pA, args->lda,
+                         job->sequence, &job->request);
+    plasma_omp_zdesc2ge(args->B, args->pB, args->ldb,
+                        job->sequence, &job->request);
+}
+
+/******************************************************************************/
+static void zgesv_finish(plasma_job_t *job)
+{
+    zgesv_job_t *args = (zgesv_job_t*)job;
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&args->A);
+    plasma_desc_destroy(&args->B);
+    free(args);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_gesv
+ *
+ *  Solves a general system of linear equations using LU factorization
+ *  with partial pivoting.
+ *  Non-blocking version of plasma_zgesv(): the solve is submitted to a
+ *  thread of the PLASMA context and the call returns at once.
+ *  Solves submitted one after another by the same thread overlap.
+ *  The caller needs not be in an OpenMP region, and must not touch
+ *  A, ipiv and B until plasma_sequence_wait() returns.
+ *
+ *******************************************************************************
+ *
+ *  Same arguments as plasma_zgesv(), and
+ *
+ * @param[in] sequence
+ *          Sequence created by plasma_sequence_create(). Its status is that
+ *          of plasma_zgesv() once plasma_sequence_wait() has returned.
+ *          A sequence may collect several async calls of the same thread.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess the solve was submitted
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgesv
+ * @sa plasma_sequence_wait
+ * @sa plasma_sequence_test
+ * @sa plasma_cgesv_async
+ * @sa plasma_dgesv_async
+ * @sa plasma_sgesv_async
+ *
+ ******************************************************************************/
+int plasma_zgesv_async(int n, int nrhs,
+                       plasma_complex64_t *pA, int lda, int *ipiv,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_sequence_t *sequence)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -1;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -2;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -4;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return -8;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+        return PlasmaSuccess;
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "gesv", PlasmaComplexDouble, n, n, nrhs);
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    zgesv_job_t *args = (zgesv_job_t*)malloc(sizeof(zgesv_job_t));
+    if (args == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Create tile matrices.
+    int retval;
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, 0, 0, n, n,
+                                                &args->A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        free(args);
+        return retval;
+    }
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &args->B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        plasma_desc_destroy(&args->A);
+        free(args);
+        return retval;
+    }
+
+    args->job.run = zgesv_run;
+    args->job.finish = zgesv_finish;
+    args->job.sequence = sequence;
+    args->job.request = PlasmaRequestInitializer;
+    args->pA = pA;
+    args->lda = lda;
+    args->ipiv = ipiv;
+    args->pB = pB;
+    args->ldb = ldb;
+
+    retval = plasma_runtime_submit(&args->job);
+    if (retval != PlasmaSuccess)
+        zgesv_finish(&args->job);
+
+    return retval;
+}
+
 /***************************************************************************//**
  *
  ******************************************************************************/
@@ -164,7 +349,8 @@ void plasma_omp_zgesv(plasma_desc_t A, int *ipiv,
         return;
 
     // Call the parallel functions.
-    plasma_pzgetrf(A, ipiv, sequence, request);
+    plasma_pzgetrf(A, ipiv, plasma->ib, plasma->max_panel_threads,
+                   plasma->lookahead, sequence, request);
 
     // Need to synchronize here because ipiv has to be completed
     // before starting row permutations.
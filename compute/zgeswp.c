@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 
 /******************************************************************************/
@@ -52,14 +53,18 @@ int plasma_zgeswp(plasma_enum_t colrow,
     if (imin(n, m) == 0)
       return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "geswp", PlasmaComplexDouble, m, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
     // Create tile matrices.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_general_desc_create() failed");
         return retval;
@@ -50,21 +50,18 @@ int plasma_zgetrf(int m, int n,
         return PlasmaSuccess;
 
     // Tune parameters.
-    // if (plasma->tuning)
-    //     plasma_tune_getrf(plasma, PlasmaComplexDouble, m, n);
+    if (plasma->tuning)
+        plasma_tune(plasma, "getrf", PlasmaComplexDouble, m, n, 0);
 
     int nb = plasma->nb;
 
-    // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
-
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -79,25 +76,19 @@ int plasma_zgetrf(int m, int n,
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
+    // Translation, factorization and translation back form one task graph.
+    // Columns are translated and factored as they become available.
     #pragma omp parallel
     #pragma omp master
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-    }
+        plasma_pzge2desc_col(pA, lda, A, sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Call the tile async function.
         plasma_omp_zgetrf(A, ipiv, sequence, &request);
-    }
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
+        plasma_pzdesc2ge_col(A, pA, lda, sequence, &request);
     }
 
     // Free matrix A in tile layout.
@@ -145,5 +136,6 @@ void plasma_omp_zgetrf(plasma_desc_t A, int *ipiv,
         return;
 
     // Call the parallel function.
-    plasma_pzgetrf(A, ipiv, sequence, request);
+    plasma_pzgetrf(A, ipiv, plasma->ib, plasma->max_panel_threads,
+                   plasma->lookahead, sequence, request);
 }
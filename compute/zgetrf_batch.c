@@ -0,0 +1,176 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/******************************************************************************/
+// Runs a batch of LU factorizations. Problem i takes its dimensions
+// from index i*inc of the arrays, so that inc = 0 gives a fixed-size batch.
+static int zgetrf_batch(const int *m, const int *n,
+                        plasma_complex64_t **pA, const int *lda, int **ipiv,
+                        int *info, int batch, int inc)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (batch < 0) {
+        plasma_error("illegal value of batch");
+        return -7;
+    }
+    int num = inc == 0 ? imin(batch, 1) : batch;
+    double flops = 0.0;
+    for (int i = 0; i < num; i++) {
+        if (m[i] < 0) {
+            plasma_error("illegal value of m");
+            return -1;
+        }
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -2;
+        }
+        if (lda[i] < imax(1, m[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+        flops += (double)m[i]*n[i]*imin(m[i], n[i]);
+    }
+
+    // quick return
+    if (batch == 0)
+        return PlasmaSuccess;
+
+    // Run groups of problems as tasks, without translation to tile layout.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        int group = plasma_batch_group(batch, flops/num, omp_get_num_threads());
+        for (int first = 0; first < batch; first += group) {
+            int last = imin(first+group, batch);
+            #pragma omp task
+            {
+                for (int i = first; i < last; i++) {
+                    int j = i*inc;
+                    info[i] = imin(m[j], n[j]) > 0 ?
+                              LAPACKE_zgetrf_work(LAPACK_COL_MAJOR,
+                                                  m[j], n[j],
+                                                  pA[i], lda[j], ipiv[i]) :
+                              0;
+                }
+            }
+        }
+    }
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorizations with partial pivoting of a batch of
+ *  general m-by-n matrices A_i of the same size, each small enough to be
+ *  factored by one thread. The factorizations have the form
+ *
+ *    \f[ A_i = P_i \times L_i \times U_i. \f]
+ *
+ *  The problems are factored in one parallel region, directly on the
+ *  arrays, without translation to tile layout.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the matrices A_i. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of the matrices A_i. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch pointers to the matrices A_i. On exit, the factors
+ *          L_i and U_i; the unit diagonal elements of L_i are not stored.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i. lda >= max(1,m).
+ *
+ * @param[out] ipiv
+ *          Array of batch pointers to the pivot indices of the problems,
+ *          each of dimension min(m,n); for 1 <= j <= min(m,n), row j of A_i
+ *          was interchanged with row ipiv[i][j-1].
+ *
+ * @param[out] info
+ *          Array of batch elements. On exit, info[i] = 0 if A_i was
+ *          factored, or j > 0 if U_i(j,j) is exactly zero.
+ *
+ * @param[in] batch
+ *          The number of problems. batch >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit; check info for each problem
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrf_vbatch
+ * @sa plasma_zgetrs_batch
+ * @sa plasma_zgetrf
+ * @sa plasma_cgetrf_batch
+ * @sa plasma_dgetrf_batch
+ * @sa plasma_sgetrf_batch
+ *
+ ******************************************************************************/
+int plasma_zgetrf_batch(int m, int n,
+                        plasma_complex64_t **pA, int lda, int **ipiv,
+                        int *info, int batch)
+{
+    return zgetrf_batch(&m, &n, pA, &lda, ipiv, info, batch, 0);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrf
+ *
+ *  Computes the LU factorizations with partial pivoting of a batch of
+ *  general matrices A_i of varying sizes.
+ *  Same as plasma_zgetrf_batch, except that m, n and lda are arrays of batch
+ *  elements, one for each problem.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit; check info for each problem
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *             for some problem
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrf_batch
+ * @sa plasma_cgetrf_vbatch
+ * @sa plasma_dgetrf_vbatch
+ * @sa plasma_sgetrf_vbatch
+ *
+ ******************************************************************************/
+int plasma_zgetrf_vbatch(const int *m, const int *n,
+                         plasma_complex64_t **pA, const int *lda, int **ipiv,
+                         int *info, int batch)
+{
+    return zgetrf_batch(m, n, pA, lda, ipiv, info, batch, 1);
+}
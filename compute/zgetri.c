@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -76,6 +77,10 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
     if (imax(n, 0) == 0)
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "getri", PlasmaComplexDouble, n, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -83,10 +88,10 @@ int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv)
     plasma_desc_t A;
     plasma_desc_t W;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
     retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
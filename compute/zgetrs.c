@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -53,12 +54,13 @@ int plasma_zgetrs(int n, int nrhs,
     if (imin(n, nrhs) == 0)
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "getrs", PlasmaComplexDouble, n, n, nrhs);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Initialize barrier.
-    plasma_barrier_init(&plasma->barrier);
-
     // Create tile matrix.
     plasma_desc_t A;
     plasma_desc_t B;
@@ -69,10 +71,11 @@ int plasma_zgetrs(int n, int nrhs,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -87,24 +90,19 @@ int plasma_zgetrs(int n, int nrhs,
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
+    // Translation, solve and translation back form one task graph.
+    // Columns of B are translated as whole columns, since
+    // plasma_pzgeswp() tracks dependencies by column.
     #pragma omp parallel
     #pragma omp master
     {
         // Translate to tile layout.
         plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
-    }
+        plasma_pzge2desc_col(pB, ldb, B, sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Call the tile async function.
         plasma_omp_zgetrs(A, ipiv, B, sequence, &request);
-    }
 
-    #pragma omp parallel
-    #pragma omp master
-    {
         // Translate back to LAPACK layout.
         plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
     }
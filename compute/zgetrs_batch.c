@@ -0,0 +1,194 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/******************************************************************************/
+// Runs a batch of solves with LU factors. Problem i takes its dimensions
+// from index i*inc of the arrays, so that inc = 0 gives a fixed-size batch.
+static int zgetrs_batch(const int *n, const int *nrhs,
+                        plasma_complex64_t **pA, const int *lda, int **ipiv,
+                        plasma_complex64_t **pB, const int *ldb,
+                        int batch, int inc)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if (batch < 0) {
+        plasma_error("illegal value of batch");
+        return -8;
+    }
+    int num = inc == 0 ? imin(batch, 1) : batch;
+    double flops = 0.0;
+    for (int i = 0; i < num; i++) {
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -1;
+        }
+        if (nrhs[i] < 0) {
+            plasma_error("illegal value of nrhs");
+            return -2;
+        }
+        if (lda[i] < imax(1, n[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+        if (ldb[i] < imax(1, n[i])) {
+            plasma_error("illegal value of ldb");
+            return -7;
+        }
+        flops += 2.0*n[i]*n[i]*nrhs[i];
+    }
+
+    // quick return
+    if (batch == 0)
+        return PlasmaSuccess;
+
+    // Run groups of problems as tasks, without translation to tile layout.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        int group = plasma_batch_group(batch, flops/num, omp_get_num_threads());
+        for (int first = 0; first < batch; first += group) {
+            int last = imin(first+group, batch);
+            #pragma omp task
+            {
+                for (int i = first; i < last; i++) {
+                    int j = i*inc;
+                    if (n[j] == 0 || nrhs[j] == 0)
+                        continue;
+
+                    LAPACKE_zlaswp_work(LAPACK_COL_MAJOR, nrhs[j],
+                                        pB[i], ldb[j], 1, n[j], ipiv[i], 1);
+                    core_ztrsm(PlasmaLeft, PlasmaLower,
+                               PlasmaNoTrans, PlasmaUnit,
+                               n[j], nrhs[j],
+                               1.0, pA[i], lda[j],
+                                    pB[i], ldb[j]);
+                    core_ztrsm(PlasmaLeft, PlasmaUpper,
+                               PlasmaNoTrans, PlasmaNonUnit,
+                               n[j], nrhs[j],
+                               1.0, pA[i], lda[j],
+                                    pB[i], ldb[j]);
+                }
+            }
+        }
+    }
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves a batch of systems of linear equations A_i * X_i = B_i of the
+ *  same size, with the LU factors of A_i computed by plasma_zgetrf_batch.
+ *  Each problem should be small enough to be solved by one thread.
+ *  The problems are solved in one parallel region, directly on the arrays,
+ *  without translation to tile layout.
+ *
+ *******************************************************************************
+ *
+ * @param[in] n
+ *          The order of the matrices A_i. n >= 0.
+ *
+ * @param[in] nrhs
+ *          The number of right hand sides, i.e., the number of columns
+ *          of the matrices B_i. nrhs >= 0.
+ *
+ * @param[in] pA
+ *          Array of batch pointers to the LU factors of A_i, as computed by
+ *          plasma_zgetrf_batch.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i. lda >= max(1,n).
+ *
+ * @param[in] ipiv
+ *          Array of batch pointers to the pivot indices of the problems,
+ *          as computed by plasma_zgetrf_batch.
+ *
+ * @param[in,out] pB
+ *          Array of batch pointers to the n-by-nrhs right hand sides B_i.
+ *          On exit, the solutions X_i.
+ *
+ * @param[in] ldb
+ *          The leading dimension of the arrays B_i. ldb >= max(1,n).
+ *
+ * @param[in] batch
+ *          The number of problems. batch >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrs_vbatch
+ * @sa plasma_zgetrf_batch
+ * @sa plasma_zgetrs
+ * @sa plasma_cgetrs_batch
+ * @sa plasma_dgetrs_batch
+ * @sa plasma_sgetrs_batch
+ *
+ ******************************************************************************/
+int plasma_zgetrs_batch(int n, int nrhs,
+                        plasma_complex64_t **pA, int lda, int **ipiv,
+                        plasma_complex64_t **pB, int ldb,
+                        int batch)
+{
+    return zgetrs_batch(&n, &nrhs, pA, &lda, ipiv, pB, &ldb, batch, 0);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_getrs
+ *
+ *  Solves a batch of systems of linear equations A_i * X_i = B_i of varying
+ *  sizes, with the LU factors of A_i computed by plasma_zgetrf_vbatch.
+ *  Same as plasma_zgetrs_batch, except that n, nrhs, lda and ldb are arrays
+ *  of batch elements, one for each problem.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *             for some problem
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zgetrs_batch
+ * @sa plasma_cgetrs_vbatch
+ * @sa plasma_dgetrs_vbatch
+ * @sa plasma_sgetrs_vbatch
+ *
+ ******************************************************************************/
+int plasma_zgetrs_vbatch(const int *n, const int *nrhs,
+                         plasma_complex64_t **pA, const int *lda, int **ipiv,
+                         plasma_complex64_t **pB, const int *ldb,
+                         int batch)
+{
+    return zgetrs_batch(n, nrhs, pA, lda, ipiv, pB, ldb, batch, 1);
+}
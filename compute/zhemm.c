@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -146,6 +147,10 @@ int plasma_zhemm(plasma_enum_t side, plasma_enum_t uplo,
     if (m == 0 || n == 0 || (alpha == 0.0 && beta == 1.0))
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "hemm", PlasmaComplexDouble, m, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -167,10 +172,10 @@ int plasma_zhemm(plasma_enum_t side, plasma_enum_t uplo,
         plasma_desc_destroy(&A);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &C);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pC, ldc,
+                                                nb, nb, m, n, 0, 0, m, n, &C);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         plasma_desc_destroy(&B);
         return retval;
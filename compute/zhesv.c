@@ -127,9 +127,6 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Initialize barrier
-    plasma_barrier_init(&plasma->barrier);
-
     // Initialize tile matrix descriptors.
     plasma_desc_t A;
     plasma_desc_t T;
@@ -153,10 +150,11 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
         plasma_error("plasma_desc_general_band_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
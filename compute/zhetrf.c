@@ -121,18 +121,15 @@ int plasma_zhetrf(plasma_enum_t uplo,
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Initialize barrier
-    plasma_barrier_init(&plasma->barrier);
-
     // Create tile matrix.
     plasma_desc_t A;
     plasma_desc_t T;
     plasma_desc_t W;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
     // band matrix (general band to prepare for band solve)
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 
 /***************************************************************************//**
@@ -115,22 +116,26 @@ int plasma_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
     if (imin(n, m) == 0)
       return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "lacpy", PlasmaComplexDouble, m, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Create tile matrices.
+    // Create descriptors of the LAPACK arrays.
     plasma_desc_t A, B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, lda,
+                                             nb, nb, m, n, 0, 0, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_general_desc_create() failed");
+        plasma_error("plasma_desc_general_lapack_init() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &B);
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, ldb,
+                                             nb, nb, m, n, 0, 0, m, n, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_general_desc_create() failed");
+        plasma_error("plasma_desc_general_lapack_init() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -150,20 +155,12 @@ int plasma_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
-
         // Call tile async function.
         plasma_omp_zlacpy(uplo, transa, A, B, sequence, &request);
-
-        // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
     }
     // implicit synchronization
 
-    // Free matrices in tile layout.
+    // Destroy the descriptors.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
 
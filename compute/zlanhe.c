@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 
 /***************************************************************************//**
@@ -110,16 +111,20 @@ double plasma_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
     if (n == 0)
       return 0.0;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "lanhe", PlasmaComplexDouble, n, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
-    // Create tile matrices.
+    // Create descriptor of the LAPACK array.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, lda,
+                                             nb, nb, n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_lapack_init() failed");
         return retval;
     }
 
@@ -159,9 +164,6 @@ double plasma_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-
         // Call tile async function.
         plasma_omp_zlanhe(norm, uplo, A, work, &value, sequence, &request);
     }
@@ -169,7 +171,7 @@ double plasma_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
 
     free(work);
 
-    // Free matrix in tile layout.
+    // Destroy the descriptor.
     plasma_desc_destroy(&A);
 
     // Destroy sequence.
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -131,6 +132,10 @@ int plasma_zpbsv(plasma_enum_t uplo,
     if (imin(n, nrhs) == 0)
        return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "pbsv", PlasmaComplexDouble, n, n, nrhs);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -145,10 +150,11 @@ int plasma_zpbsv(plasma_enum_t uplo,
         plasma_error("plasma_desc_general_band_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        ldb, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, ldb, nrhs, 0, 0,
+                                                n, nrhs, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&AB);
         return retval;
     }
@@ -96,7 +96,7 @@ int plasma_zpoinv(plasma_enum_t uplo,
 
     // Tune parameters.
     if (plasma->tuning)
-        plasma_tune_poinv(plasma, PlasmaComplexDouble, n);
+        plasma_tune(plasma, "poinv", PlasmaComplexDouble, n, n, 0);
 
     // Set tiling parameters.
     int nb = plasma->nb;
@@ -228,7 +228,7 @@ void plasma_omp_zpoinv(plasma_enum_t uplo, plasma_desc_t A,
     }
 
     // Factorize A.
-    plasma_pzpotrf(uplo, A, sequence, request);
+    plasma_pzpotrf(uplo, A, plasma->lookahead, sequence, request);
 
     // Invert triangular part.
     plasma_pztrtri(uplo, PlasmaNonUnit, A, sequence, request);
@@ -15,6 +15,8 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_runtime.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -125,6 +127,10 @@ int plasma_zposv(plasma_enum_t uplo,
     if (imin(n, nrhs) == 0)
        return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "posv", PlasmaComplexDouble, n, n, nrhs);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -132,16 +138,17 @@ int plasma_zposv(plasma_enum_t uplo,
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -184,6 +191,196 @@ int plasma_zposv(plasma_enum_t uplo,
     return status;
 }
 
+/******************************************************************************/
+// Arguments of plasma_zposv_async(), kept until the solve completes.
+typedef struct {
+    plasma_job_t job;
+    plasma_enum_t uplo;
+    plasma_complex64_t *pA;
+    int lda;
+    plasma_complex64_t *pB;
+    int ldb;
+    plasma_desc_t A;
+    plasma_desc_t B;
+} zposv_job_t;
+
+/******************************************************************************/
+static void zposv_run(plasma_job_t *job)
+{
+    zposv_job_t *args = (zposv_job_t*)job;
+
+    // Translate to tile layout.
+    plasma_omp_zge2desc(args->pA, args->lda, args->A,
+                        job->sequence, &job->request);
+    plasma_omp_zge2desc(args->pB, args->ldb, args->B,
+                        job->sequence, &job->request);
+
+    // Solve with the tuning of the submission, as plasma_omp_zposv()
+    // would with that of the context.
+    plasma_pzpotrf(args->uplo, args->A, job->lookahead,
+                   job->sequence, &job->request);
+
+    plasma_enum_t trans;
+    trans = args->uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans;
+    plasma_pztrsm(PlasmaLeft, args->uplo, trans, PlasmaNonUnit,
+                  1.0, args->A,
+                       args->B,
+                  job->sequence, &job->request);
+
+    trans = args->uplo == PlasmaUpper ? PlasmaNoTrans : PlasmaConjTrans;
+    plasma_pztrsm(PlasmaLeft, args->uplo, trans, PlasmaNonUnit,
+                  1.0, args->A,
+                       args->B,
+                  job->sequence, &job->request);
+
+    // Translate back to LAPACK layout.
+    plasma_omp_zdesc2ge(args->A, args->pA, args->lda,
+                        job->sequence, &job->request);
+    plasma_omp_zdesc2ge(args->B, args->pB, args->ldb,
+                        job->sequence, &job->request);
+}
+
+/******************************************************************************/
+static void zposv_finish(plasma_job_t *job)
+{
+    zposv_job_t *args = (zposv_job_t*)job;
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&args->A);
+    plasma_desc_destroy(&args->B);
+    free(args);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_posv
+ *
+ *  Solves a Hermitian positive definite system of linear equations
+ *  using Cholesky factorization.
+ *  Non-blocking version of plasma_zposv(): the solve is submitted to a
+ *  thread of the PLASMA context and the call returns at once.
+ *  Solves submitted one after another by the same thread overlap.
+ *  The caller needs not be in an OpenMP region, and must not touch
+ *  A and B until plasma_sequence_wait() returns.
+ *
+ *******************************************************************************
+ *
+ *  Same arguments as plasma_zposv(), and
+ *
+ * @param[in] sequence
+ *          Sequence created by plasma_sequence_create(). Its status is that
+ *          of plasma_zposv() once plasma_sequence_wait() has returned.
+ *          A sequence may collect several async calls of the same thread.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess the solve was submitted
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zposv
+ * @sa plasma_sequence_wait
+ * @sa plasma_sequence_test
+ * @sa plasma_cposv_async
+ * @sa plasma_dposv_async
+ * @sa plasma_sposv_async
+ *
+ ******************************************************************************/
+int plasma_zposv_async(plasma_enum_t uplo,
+                       int n, int nrhs,
+                       plasma_complex64_t *pA, int lda,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_sequence_t *sequence)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (nrhs < 0) {
+        plasma_error("illegal value of nrhs");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldb < imax(1, n)) {
+        plasma_error("illegal value of ldb");
+        return -7;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return -8;
+    }
+
+    // quick return
+    if (imin(n, nrhs) == 0)
+       return PlasmaSuccess;
+
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "posv", PlasmaComplexDouble, n, n, nrhs);
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    zposv_job_t *args = (zposv_job_t*)malloc(sizeof(zposv_job_t));
+    if (args == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Create tile matrices.
+    int retval;
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, 0, 0, n, n,
+                                                &args->A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        free(args);
+        return retval;
+    }
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &args->B);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_inplace_create() failed");
+        plasma_desc_destroy(&args->A);
+        free(args);
+        return retval;
+    }
+
+    args->job.run = zposv_run;
+    args->job.finish = zposv_finish;
+    args->job.sequence = sequence;
+    args->job.request = PlasmaRequestInitializer;
+    args->uplo = uplo;
+    args->pA = pA;
+    args->lda = lda;
+    args->pB = pB;
+    args->ldb = ldb;
+
+    retval = plasma_runtime_submit(&args->job);
+    if (retval != PlasmaSuccess)
+        zposv_finish(&args->job);
+
+    return retval;
+}
+
 /***************************************************************************//**
  *
  * @ingroup plasma_posv
@@ -283,7 +480,7 @@ void plasma_omp_zposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
         return;
 
     // Call the parallel functions.
-    plasma_pzpotrf(uplo, A, sequence, request);
+    plasma_pzpotrf(uplo, A, plasma->lookahead, sequence, request);
 
     plasma_enum_t trans;
     trans = uplo == PlasmaUpper ? PlasmaConjTrans : PlasmaNoTrans;
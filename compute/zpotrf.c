@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -100,16 +101,20 @@ int plasma_zpotrf(plasma_enum_t uplo,
     if (imax(n, 0) == 0)
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "potrf", PlasmaComplexDouble, n, n, 0);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &A);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pA, lda,
+                                                nb, nb, n, n, 0, 0, n, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         return retval;
     }
 
@@ -124,6 +129,20 @@ int plasma_zpotrf(plasma_enum_t uplo,
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
+    // Record the tasks of the first call of this shape,
+    // to replay them in this call and the later ones.
+    plasma_graph_t *graph = NULL;
+    if (plasma->task_graph == PlasmaEnabled) {
+        graph = plasma_graph_find("potrf", uplo, &A, 1);
+        if (graph == NULL &&
+            plasma_graph_create("potrf", uplo, &A, 1,
+                                &sequence->graph) == PlasmaSuccess) {
+            plasma_omp_zpotrf(uplo, A, sequence, &request);
+            graph = plasma_graph_finalize(sequence->graph);
+            sequence->graph = NULL;
+        }
+    }
+
     // asynchronous block
     #pragma omp parallel
     #pragma omp master
@@ -131,8 +150,11 @@ int plasma_zpotrf(plasma_enum_t uplo,
         // Translate to tile layout.
         plasma_omp_zge2desc(pA, lda, A, sequence, &request);
 
-        // Call the tile async function.
-        plasma_omp_zpotrf(uplo, A, sequence, &request);
+        // Call the tile async function, or replay its tasks.
+        if (graph != NULL)
+            plasma_pzgraph(graph, &A, sequence, &request);
+        else
+            plasma_omp_zpotrf(uplo, A, sequence, &request);
 
         // Translate back to LAPACK layout.
         plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
@@ -241,5 +263,5 @@ void plasma_omp_zpotrf(plasma_enum_t uplo, plasma_desc_t A,
         return;
 
     // Call the parallel function.
-    plasma_pzpotrf(uplo, A, sequence, request);
+    plasma_pzpotrf(uplo, A, plasma->lookahead, sequence, request);
 }
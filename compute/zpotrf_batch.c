@@ -0,0 +1,175 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include "core_blas.h"
+
+#include <omp.h>
+
+/******************************************************************************/
+// Runs a batch of Cholesky factorizations. Problem i takes its dimensions
+// from index i*inc of the arrays, so that inc = 0 gives a fixed-size batch.
+static int zpotrf_batch(plasma_enum_t uplo,
+                        const int *n,
+                        plasma_complex64_t **pA, const int *lda,
+                        int *info, int batch, int inc)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (batch < 0) {
+        plasma_error("illegal value of batch");
+        return -6;
+    }
+    int num = inc == 0 ? imin(batch, 1) : batch;
+    double flops = 0.0;
+    for (int i = 0; i < num; i++) {
+        if (n[i] < 0) {
+            plasma_error("illegal value of n");
+            return -2;
+        }
+        if (lda[i] < imax(1, n[i])) {
+            plasma_error("illegal value of lda");
+            return -4;
+        }
+        flops += (double)n[i]*n[i]*n[i]/3.0;
+    }
+
+    // quick return
+    if (batch == 0)
+        return PlasmaSuccess;
+
+    // Run groups of problems as tasks, without translation to tile layout.
+    #pragma omp parallel
+    #pragma omp master
+    {
+        int group = plasma_batch_group(batch, flops/num, omp_get_num_threads());
+        for (int first = 0; first < batch; first += group) {
+            int last = imin(first+group, batch);
+            #pragma omp task
+            {
+                for (int i = first; i < last; i++) {
+                    int j = i*inc;
+                    info[i] = n[j] > 0 ? core_zpotrf(uplo, n[j], pA[i], lda[j])
+                                       : 0;
+                }
+            }
+        }
+    }
+
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorizations of a batch of Hermitian positive
+ *  definite matrices A_i of the same size, each small enough to be
+ *  factored by one thread. The factorizations have the form
+ *
+ *    \f[ A_i = L_i \times L_i^H, \f]
+ *    or
+ *    \f[ A_i = U_i^H \times U_i. \f]
+ *
+ *  The problems are factored in one parallel region, directly on the
+ *  arrays, without translation to tile layout.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: Upper triangles of A_i are stored;
+ *          - PlasmaLower: Lower triangles of A_i are stored.
+ *
+ * @param[in] n
+ *          The order of the matrices A_i. n >= 0.
+ *
+ * @param[in,out] pA
+ *          Array of batch pointers to the matrices A_i, referenced as in
+ *          plasma_zpotrf. On exit, if info[i] = 0, the factor U_i or L_i.
+ *
+ * @param[in] lda
+ *          The leading dimension of the arrays A_i. lda >= max(1,n).
+ *
+ * @param[out] info
+ *          Array of batch elements. On exit, info[i] = 0 if A_i was
+ *          factored, or j > 0 if the leading minor of order j of A_i is
+ *          not positive definite.
+ *
+ * @param[in] batch
+ *          The number of problems. batch >= 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit; check info for each problem
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpotrf_vbatch
+ * @sa plasma_zpotrf
+ * @sa plasma_cpotrf_batch
+ * @sa plasma_dpotrf_batch
+ * @sa plasma_spotrf_batch
+ *
+ ******************************************************************************/
+int plasma_zpotrf_batch(plasma_enum_t uplo,
+                        int n,
+                        plasma_complex64_t **pA, int lda,
+                        int *info, int batch)
+{
+    return zpotrf_batch(uplo, &n, pA, &lda, info, batch, 0);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Performs the Cholesky factorizations of a batch of Hermitian positive
+ *  definite matrices A_i of varying sizes.
+ *  Same as plasma_zpotrf_batch, except that n and lda are arrays of batch
+ *  elements, one for each problem.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit; check info for each problem
+ * @retval < 0 if -i, the i-th argument had an illegal value
+ *             for some problem
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_zpotrf_batch
+ * @sa plasma_cpotrf_vbatch
+ * @sa plasma_dpotrf_vbatch
+ * @sa plasma_spotrf_vbatch
+ *
+ ******************************************************************************/
+int plasma_zpotrf_vbatch(plasma_enum_t uplo,
+                         const int *n,
+                         plasma_complex64_t **pA, const int *lda,
+                         int *info, int batch)
+{
+    return zpotrf_batch(uplo, n, pA, lda, info, batch, 1);
+}
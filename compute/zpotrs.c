@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -112,6 +113,10 @@ int plasma_zpotrs(plasma_enum_t uplo,
     if (imax(n, nrhs) == 0)
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "potrs", PlasmaComplexDouble, n, n, nrhs);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -125,10 +130,11 @@ int plasma_zpotrs(plasma_enum_t uplo,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, nrhs, 0, 0, n, nrhs, &B);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pB, ldb,
+                                                nb, nb, n, nrhs, 0, 0, n, nrhs,
+                                                &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -144,6 +150,21 @@ int plasma_zpotrs(plasma_enum_t uplo,
     // Initialize request.
     plasma_request_t request = PlasmaRequestInitializer;
 
+    // Record the tasks of the first call of this shape,
+    // to replay them in this call and the later ones.
+    plasma_desc_t descs[] = { A, B };
+    plasma_graph_t *graph = NULL;
+    if (plasma->task_graph == PlasmaEnabled) {
+        graph = plasma_graph_find("potrs", uplo, descs, 2);
+        if (graph == NULL &&
+            plasma_graph_create("potrs", uplo, descs, 2,
+                                &sequence->graph) == PlasmaSuccess) {
+            plasma_omp_zpotrs(uplo, A, B, sequence, &request);
+            graph = plasma_graph_finalize(sequence->graph);
+            sequence->graph = NULL;
+        }
+    }
+
     // asynchronous block
     #pragma omp parallel
     #pragma omp master
@@ -152,8 +173,11 @@ int plasma_zpotrs(plasma_enum_t uplo,
         plasma_omp_zge2desc(pA, lda, A, sequence, &request);
         plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
 
-        // Call the tile async function.
-        plasma_omp_zpotrs(uplo, A, B, sequence, &request);
+        // Call the tile async function, or replay its tasks.
+        if (graph != NULL)
+            plasma_pzgraph(graph, descs, sequence, &request);
+        else
+            plasma_omp_zpotrs(uplo, A, B, sequence, &request);
 
         // Translate back to LAPACK layout.
         plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
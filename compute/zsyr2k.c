@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -162,6 +163,10 @@ int plasma_zsyr2k(plasma_enum_t uplo, plasma_enum_t trans,
     if (n == 0 || ((alpha == 0.0 || k == 0.0) && beta == 1.0))
         return PlasmaSuccess;
 
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "syr2k", PlasmaComplexDouble, n, n, k);
+
     // Set tiling parameters.
     int nb = plasma->nb;
 
@@ -183,10 +188,10 @@ int plasma_zsyr2k(plasma_enum_t uplo, plasma_enum_t trans,
         plasma_desc_destroy(&A);
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        n, n, 0, 0, n, n, &C);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pC, ldc,
+                                                nb, nb, n, n, 0, 0, n, n, &C);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         plasma_desc_destroy(&B);
         return retval;
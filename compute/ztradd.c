@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tuning.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -158,22 +159,26 @@ int plasma_ztradd(plasma_enum_t uplo, plasma_enum_t transa,
         return PlasmaSuccess;
 
     // Set tiling parameters
+    // Tune parameters.
+    if (plasma->tuning)
+        plasma_tune(plasma, "tradd", PlasmaComplexDouble, m, n, 0);
+
     int nb = plasma->nb;
 
-    // Create tile matrices
+    // Create descriptors of the LAPACK arrays
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pA, lda,
+                                             nb, nb, am, an, 0, 0, am, an, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_lapack_init() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
+    retval = plasma_desc_general_lapack_init(PlasmaComplexDouble, pB, ldb,
+                                             nb, nb, bm, bn, 0, 0, bm, bn, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_lapack_init() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
@@ -193,23 +198,15 @@ int plasma_ztradd(plasma_enum_t uplo, plasma_enum_t transa,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout
-        plasma_omp_zge2desc(pA, lda, A, sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, sequence, &request);
-
         // Call tile async function
         plasma_omp_ztradd(uplo, transa,
                           alpha,     A,
                           beta,      B,
                           sequence, &request);
-
-        // Translate back to LAPACK layout
-        plasma_omp_zdesc2ge(A, pA, lda, sequence, &request);
-        plasma_omp_zdesc2ge(B, pB, ldb, sequence, &request);
     }
     // Implicit synchronization
 
-    // Free matrices in tile layout
+    // Destroy the descriptors
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&B);
 
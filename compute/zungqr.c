@@ -121,20 +121,20 @@ int plasma_zungqr(int m, int n, int k,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, k, &Q);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pQ, ldq,
+                                                nb, nb, m, n, 0, 0, m, k, &Q);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
 
-    // Allocate workspace.
-    plasma_workspace_t work;
+    // Prepare workspace.
     size_t lwork = ib*nb;  // unmqr: work
-    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    retval = plasma_workspace_reserve(&plasma->work, lwork,
+                                      PlasmaComplexDouble);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_workspace_create() failed");
+        plasma_error("plasma_workspace_reserve() failed");
         return retval;
     }
 
@@ -158,15 +158,13 @@ int plasma_zungqr(int m, int n, int k,
         plasma_omp_zge2desc(pQ, ldq, Q, sequence, &request);
 
         // Call the tile async function.
-        plasma_omp_zungqr(A, T, Q, work, sequence, &request);
+        plasma_omp_zungqr(A, T, Q, plasma->work, sequence, &request);
 
         // Translate Q back to LAPACK layout.
         plasma_omp_zdesc2ge(Q, pQ, ldq, sequence, &request);
     }
     // implicit synchronization
 
-    plasma_workspace_destroy(&work);
-
     // Free matrices in tile layout.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&Q);
@@ -161,20 +161,20 @@ int plasma_zunmlq(plasma_enum_t side, plasma_enum_t trans,
         plasma_error("plasma_desc_general_create() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &C);
+    retval = plasma_desc_general_inplace_create(PlasmaComplexDouble, pC, ldc,
+                                                nb, nb, m, n, 0, 0, m, n, &C);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_inplace_create() failed");
         plasma_desc_destroy(&A);
         return retval;
     }
 
-    // Allocate workspace.
-    plasma_workspace_t work;
+    // Prepare workspace.
     size_t lwork = ib*nb;  // unmlq: work
-    retval = plasma_workspace_create(&work, lwork, PlasmaComplexDouble);
+    retval = plasma_workspace_reserve(&plasma->work, lwork,
+                                      PlasmaComplexDouble);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_workspace_create() failed");
+        plasma_error("plasma_workspace_reserve() failed");
         return retval;
     }
 
@@ -199,7 +199,7 @@ int plasma_zunmlq(plasma_enum_t side, plasma_enum_t trans,
 
         // Call the tile async function.
         plasma_omp_zunmlq(side, trans,
-                          A, T, C, work,
+                          A, T, C, plasma->work,
                           sequence, &request);
 
         // Translate back to LAPACK layout.
@@ -207,8 +207,6 @@ int plasma_zunmlq(plasma_enum_t side, plasma_enum_t trans,
     }
     // implicit synchronization
 
-    plasma_workspace_destroy(&work);
-
     // Free matrices in tile layout.
     plasma_desc_destroy(&A);
     plasma_desc_destroy(&C);
@@ -9,7 +9,9 @@
  **/
 
 #include "plasma_async.h"
+#include "plasma_context.h"
 #include "plasma_internal.h"
+#include "plasma_stats.h"
 
 #include <stdlib.h>
 
@@ -33,12 +35,107 @@ int plasma_sequence_create(plasma_sequence_t **sequence)
         return PlasmaErrorOutOfMemory;
     }
     (*sequence)->status = PlasmaSuccess;
+
+    // Tasks of the sequence follow the settings of the creating thread.
+    plasma_context_t *plasma = plasma_context_self();
+    (*sequence)->dispatch =
+        plasma != NULL && plasma->affinity == PlasmaEnabled ?
+        &plasma->dispatch : NULL;
+    (*sequence)->pending = 0;
+    (*sequence)->graph = NULL;
+
+    static int num_sequences = 0;
+    (*sequence)->id = __sync_fetch_and_add(&num_sequences, 1);
+
+    // Count the tasks if enabled, but run them anyway if out of memory.
+    // Async calls run in the team of the runtime, which has a thread
+    // more than max_threads to create the tasks.
+    (*sequence)->stats = NULL;
+    if (plasma != NULL && plasma->stats == PlasmaEnabled)
+        plasma_stats_sequence_create(plasma->max_threads+1,
+                                     &(*sequence)->stats);
     return PlasmaSuccess;
 }
 
 /******************************************************************************/
 int plasma_sequence_destroy(plasma_sequence_t *sequence)
 {
+    // Add the counters of the sequence to the context.
+    if (sequence->stats != NULL) {
+        plasma_context_t *plasma = plasma_context_self();
+        plasma_stats_sequence_destroy(
+            sequence->stats, plasma != NULL ? &plasma->stats_total : NULL);
+    }
     free(sequence);
     return PlasmaSuccess;
 }
+
+/***************************************************************************//**
+ * @ingroup plasma_async
+ *
+ * Waits for the async calls submitted with the sequence by the calling
+ * thread, e.g., by plasma_zgesv_async(), and returns the status of the
+ * sequence.
+ **/
+int plasma_sequence_wait(plasma_sequence_t *sequence)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorNullParameter;
+    }
+    plasma_runtime_t *runtime = &plasma->runtime;
+    pthread_mutex_lock(&runtime->lock);
+    while (sequence->pending > 0)
+        pthread_cond_wait(&runtime->done, &runtime->lock);
+    pthread_mutex_unlock(&runtime->lock);
+
+    return sequence->status;
+}
+
+/***************************************************************************//**
+ * @ingroup plasma_async
+ *
+ * Returns 1 if the async calls submitted with the sequence by the calling
+ * thread have completed, and 0 otherwise, without waiting. Once completed,
+ * plasma_sequence_wait() returns the status at once.
+ **/
+int plasma_sequence_test(plasma_sequence_t *sequence)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL || sequence == NULL)
+        return 1;
+
+    plasma_runtime_t *runtime = &plasma->runtime;
+    pthread_mutex_lock(&runtime->lock);
+    int done = sequence->pending == 0;
+    pthread_mutex_unlock(&runtime->lock);
+
+    return done;
+}
+
+/***************************************************************************//**
+ * @ingroup plasma_async
+ *
+ * Cancels the calls of the sequence. Tasks not yet started return at once,
+ * and the factorizations stop creating tasks at their next step. Unless the
+ * sequence has already failed, its status becomes PlasmaErrorCanceled,
+ * which is negative, apart from the positive info of a failed factorization.
+ * May be called by any thread, e.g., while another one waits for the
+ * sequence. The outputs of canceled calls are undefined.
+ **/
+int plasma_sequence_cancel(plasma_sequence_t *sequence)
+{
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        return PlasmaErrorNullParameter;
+    }
+    // Keep the status of a failed sequence.
+    __sync_bool_compare_and_swap(&sequence->status,
+                                 PlasmaSuccess, PlasmaErrorCanceled);
+    return PlasmaSuccess;
+}
@@ -10,21 +10,52 @@
 
 #include "plasma_barrier.h"
 
+#include <sched.h>
+
+// longest pause between two polls of the sense, in pause instructions
+static const int MaxBackoff = 64;
+
+// number of polls at MaxBackoff before yielding the processor
+static const int MaxSpins = 64;
+
 /******************************************************************************/
 void plasma_barrier_init(plasma_barrier_t *barrier)
 {
     barrier->count = 0;
-    barrier->passed = 0;
+    barrier->sense = 0;
 }
 
 /******************************************************************************/
 void plasma_barrier_wait(plasma_barrier_t *barrier, int size)
 {
-    int passed_old = barrier->passed;
+    // Read the sense before arriving, as the last thread reverses it.
+    int sense = barrier->sense;
+    __sync_synchronize();
 
-    __sync_fetch_and_add(&barrier->count, 1);
-    if (__sync_bool_compare_and_swap(&barrier->count, size, 0))
-        barrier->passed++;
-    else
-        while (barrier->passed == passed_old);
+    if (__sync_add_and_fetch(&barrier->count, 1) == size) {
+        barrier->count = 0;
+        __sync_synchronize();
+        barrier->sense = !sense;
+        return;
+    }
+    // Poll with exponential backoff, then yield,
+    // e.g., when there are more threads than cores.
+    int backoff = 1;
+    int spins = 0;
+    while (barrier->sense == sense) {
+        if (backoff < MaxBackoff) {
+            for (int i = 0; i < backoff; i++)
+                plasma_barrier_pause();
+            backoff *= 2;
+        }
+        else if (spins < MaxSpins) {
+            for (int i = 0; i < backoff; i++)
+                plasma_barrier_pause();
+            spins++;
+        }
+        else {
+            sched_yield();
+        }
+    }
+    __sync_synchronize();
 }
@@ -10,9 +10,11 @@
 
 #include "plasma_context.h"
 #include "plasma_internal.h"
+#include "plasma_trace.h"
 #include "plasma_tuning.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <omp.h>
 
 static int max_contexts = 1024;
@@ -21,29 +23,17 @@ static int num_contexts = 0;
 plasma_context_map_t *context_map = NULL;
 pthread_mutex_t context_map_lock = PTHREAD_MUTEX_INITIALIZER;
 
+// Context of the calling thread.
+// Looked up without locking; the map is only touched on attach and detach.
+static __thread plasma_context_t *context_self = NULL;
+
 /***************************************************************************//**
     @ingroup plasma_init
     Initializes PLASMA, allocating its context.
 */
 int plasma_init()
 {
-    pthread_mutex_lock(&context_map_lock);
-
-    // Allocate context map if NULL.
-    if (context_map == NULL) {
-        context_map =
-            (plasma_context_map_t*)calloc(max_contexts,
-                                          sizeof(plasma_context_map_t));
-        if (context_map == NULL) {
-            pthread_mutex_unlock(&context_map_lock);
-            plasma_error("calloc() failed");
-            return PlasmaErrorOutOfMemory;
-        }
-    }
-    pthread_mutex_unlock(&context_map_lock);
-
-    plasma_context_attach();
-    return PlasmaSuccess;
+    return plasma_context_attach();
 }
 
 /***************************************************************************//**
@@ -52,8 +42,7 @@ int plasma_init()
 */
 int plasma_finalize()
 {
-    plasma_context_detach();
-    return PlasmaSuccess;
+    return plasma_context_detach();
 }
 
 /******************************************************************************/
@@ -80,6 +69,7 @@ int plasma_set(plasma_enum_t param, int value)
             return PlasmaErrorIllegalValue;
         }
         plasma->nb = value;
+        plasma_tuning_cache_set(plasma, PlasmaNb);
         break;
     case PlasmaIb:
         if (value <= 0) {
@@ -87,6 +77,7 @@ int plasma_set(plasma_enum_t param, int value)
             return PlasmaErrorIllegalValue;
         }
         plasma->ib = value;
+        plasma_tuning_cache_set(plasma, PlasmaIb);
         break;
     case PlasmaNumPanelThreads:
         if (value <= 0) {
@@ -94,6 +85,7 @@ int plasma_set(plasma_enum_t param, int value)
             return PlasmaErrorIllegalValue;
         }
         plasma->max_panel_threads = value;
+        plasma_tuning_cache_set(plasma, PlasmaNumPanelThreads);
         break;
     case PlasmaHouseholderMode:
         if (value != PlasmaFlatHouseholder && value != PlasmaTreeHouseholder) {
@@ -101,6 +93,104 @@ int plasma_set(plasma_enum_t param, int value)
             return PlasmaErrorIllegalValue;
         }
         plasma->householder_mode = value;
+        plasma_tuning_cache_set(plasma, PlasmaHouseholderMode);
+        break;
+    case PlasmaInplaceOutplace:
+        if (value != PlasmaInplace && value != PlasmaOutplace) {
+            plasma_error("invalid in-place/out-of-place mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->inplace_outplace = value;
+        break;
+    case PlasmaPoolSize:
+        if (value < 0) {
+            plasma_error("invalid pool size");
+            return PlasmaErrorIllegalValue;
+        }
+        // The size is in MB, which keeps it within int.
+        plasma_pool_set_size(&plasma->pool, (size_t)value << 20);
+        break;
+    case PlasmaPoolTrim:
+        if (value != PlasmaPoolTrimOldest && value != PlasmaPoolTrimNewest) {
+            plasma_error("invalid pool trim policy");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->pool.trim = value;
+        break;
+    case PlasmaTilePlacement:
+        if (value != PlasmaPlacementNone &&
+            value != PlasmaPlacementColumnCyclic &&
+            value != PlasmaPlacementSocketCyclic &&
+            value != PlasmaPlacementInterleave) {
+            plasma_error("invalid tile placement");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->placement = value;
+        break;
+    case PlasmaNumSockets:
+        if (value <= 0) {
+            plasma_error("invalid number of sockets");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->num_sockets = value;
+        break;
+    case PlasmaTaskAffinity:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid task affinity flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->affinity = value;
+        break;
+    case PlasmaHugePages:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid huge pages flag");
+            return PlasmaErrorIllegalValue;
+        }
+        // Drop buffers allocated in the other mode.
+        if (plasma->pool.huge_pages != value) {
+            plasma_desc_pool_trim();
+            plasma->pool.huge_pages = value;
+            plasma_workspace_destroy(&plasma->work);
+            plasma->work.huge_pages = value;
+        }
+        break;
+    case PlasmaTileTable:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid tile table flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->tile_table = value;
+        break;
+    case PlasmaLookahead:
+        if (value < 0) {
+            plasma_error("invalid lookahead depth");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->lookahead = value;
+        break;
+    case PlasmaTaskGraph:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid task graph flag");
+            return PlasmaErrorIllegalValue;
+        }
+        // Drop the recorded calls when disabled.
+        if (value == PlasmaDisabled)
+            plasma_graph_cache_clear(&plasma->graphs);
+        plasma->task_graph = value;
+        break;
+    case PlasmaStats:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid stats flag");
+            return PlasmaErrorIllegalValue;
+        }
+        // Tasks read the clock while any context counts them.
+        if (value != plasma->stats) {
+            if (value == PlasmaEnabled)
+                __sync_fetch_and_add(&plasma_stats_enabled, 1);
+            else
+                __sync_fetch_and_sub(&plasma_stats_enabled, 1);
+        }
+        plasma->stats = value;
         break;
     default:
         plasma_error("unknown parameter");
@@ -135,6 +225,39 @@ int plasma_get(plasma_enum_t param, int *value)
     case PlasmaHouseholderMode:
         *value = plasma->householder_mode;
         return PlasmaSuccess;
+    case PlasmaInplaceOutplace:
+        *value = plasma->inplace_outplace;
+        return PlasmaSuccess;
+    case PlasmaPoolSize:
+        *value = (int)(plasma->pool.max_size >> 20);
+        return PlasmaSuccess;
+    case PlasmaPoolTrim:
+        *value = plasma->pool.trim;
+        return PlasmaSuccess;
+    case PlasmaTilePlacement:
+        *value = plasma->placement;
+        return PlasmaSuccess;
+    case PlasmaNumSockets:
+        *value = plasma->num_sockets;
+        return PlasmaSuccess;
+    case PlasmaTaskAffinity:
+        *value = plasma->affinity;
+        return PlasmaSuccess;
+    case PlasmaHugePages:
+        *value = plasma->pool.huge_pages;
+        return PlasmaSuccess;
+    case PlasmaTileTable:
+        *value = plasma->tile_table;
+        return PlasmaSuccess;
+    case PlasmaLookahead:
+        *value = plasma->lookahead;
+        return PlasmaSuccess;
+    case PlasmaTaskGraph:
+        *value = plasma->task_graph;
+        return PlasmaSuccess;
+    case PlasmaStats:
+        *value = plasma->stats;
+        return PlasmaSuccess;
     default:
         plasma_error("Unknown parameter");
         return PlasmaErrorIllegalValue;
@@ -145,42 +268,70 @@ int plasma_get(plasma_enum_t param, int *value)
 /******************************************************************************/
 int plasma_context_attach()
 {
-    pthread_mutex_lock(&context_map_lock);
-
-    // Reallocate context map if out of space.
-    if (num_contexts == max_contexts-1) {
-        max_contexts *= 2;
-        context_map = (plasma_context_map_t*) realloc(
-            &context_map, max_contexts*sizeof(plasma_context_map_t));
-        if (context_map == NULL) {
-            pthread_mutex_unlock(&context_map_lock);
-            plasma_error("realloc() failed");
-            return PlasmaErrorOutOfMemory;
-        }
+    if (context_self != NULL) {
+        plasma_error("context already attached");
+        return PlasmaErrorIllegalValue;
     }
     // Create the context.
     plasma_context_t *context;
     context = (plasma_context_t*)malloc(sizeof(plasma_context_t));
     if (context == NULL) {
-        pthread_mutex_unlock(&context_map_lock);
         plasma_error("malloc() failed");
         return PlasmaErrorOutOfMemory;
     }
-    // Initialize the context.
+    // Initialize the context outside of the lock,
+    // since loading the tuning file may take a while.
     plasma_context_init(context);
 
-    // Find and empty slot and insert the context.
+    pthread_mutex_lock(&context_map_lock);
+
+    // Allocate context map if NULL.
+    if (context_map == NULL) {
+        context_map =
+            (plasma_context_map_t*)calloc(max_contexts,
+                                          sizeof(plasma_context_map_t));
+        if (context_map == NULL) {
+            pthread_mutex_unlock(&context_map_lock);
+            plasma_context_finalize(context);
+            free(context);
+            plasma_error("calloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+    }
+    // Double the context map if out of space.
+    if (num_contexts == max_contexts) {
+        plasma_context_map_t *map;
+        map = (plasma_context_map_t*)realloc(
+            context_map, 2*max_contexts*sizeof(plasma_context_map_t));
+        if (map == NULL) {
+            pthread_mutex_unlock(&context_map_lock);
+            plasma_context_finalize(context);
+            free(context);
+            plasma_error("realloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+        for (int i = max_contexts; i < 2*max_contexts; i++)
+            map[i].context = NULL;
+
+        context_map = map;
+        max_contexts *= 2;
+    }
+    // Find an empty slot and insert the context.
     for (int i = 0; i < max_contexts; i++) {
         if (context_map[i].context == NULL) {
             context_map[i].context = context;
             context_map[i].thread_id = pthread_self();
             num_contexts++;
             pthread_mutex_unlock(&context_map_lock);
+
+            context_self = context;
             return PlasmaSuccess;
         }
     }
     // This should never happen.
     pthread_mutex_unlock(&context_map_lock);
+    plasma_context_finalize(context);
+    free(context);
     plasma_error("empty slot not found");
     return PlasmaErrorInternal;
 }
@@ -188,18 +339,29 @@ int plasma_context_attach()
 /******************************************************************************/
 int plasma_context_detach()
 {
+    plasma_context_t *context = context_self;
+    if (context == NULL) {
+        plasma_error("context not found");
+        return PlasmaErrorNotInitialized;
+    }
     pthread_mutex_lock(&context_map_lock);
 
-    // Find the thread and remove its context.
+    // Find the context and remove it from the map.
     for (int i = 0; i < max_contexts; i++) {
-        if (context_map[i].context != NULL &&
-            pthread_equal(context_map[i].thread_id, pthread_self())) {
-
-            plasma_context_finalize(context_map[i].context);
-            free(context_map[i].context);
+        if (context_map[i].context == context) {
             context_map[i].context = NULL;
             num_contexts--;
+
+            // Free the map with the last context.
+            if (num_contexts == 0) {
+                free(context_map);
+                context_map = NULL;
+            }
             pthread_mutex_unlock(&context_map_lock);
+
+            context_self = NULL;
+            plasma_context_finalize(context);
+            free(context);
             return PlasmaSuccess;
         }
     }
@@ -211,20 +373,20 @@ int plasma_context_detach()
 /******************************************************************************/
 plasma_context_t *plasma_context_self()
 {
-    pthread_mutex_lock(&context_map_lock);
+    // Return the context of the calling thread, if attached.
+    plasma_context_t *context = context_self;
+    if (context == NULL)
+        plasma_error("context not found");
 
-    // Find the thread and return its context.
-    for (int i = 0; i < max_contexts; i++) {
-        if (context_map[i].context != NULL &&
-            pthread_equal(context_map[i].thread_id, pthread_self())) {
+    return context;
+}
 
-            pthread_mutex_unlock(&context_map_lock);
-            return context_map[i].context;
-        }
-    }
-    pthread_mutex_unlock(&context_map_lock);
-    plasma_error("context not found");
-    return NULL;
+/******************************************************************************/
+void plasma_context_set_self(plasma_context_t *context)
+{
+    // Makes the context of another thread that of the calling thread,
+    // e.g., for the threads running its async calls.
+    context_self = context;
 }
 
 /******************************************************************************/
@@ -239,13 +401,71 @@ void plasma_context_init(plasma_context_t *context)
     context->max_panel_threads = 1;
     context->householder_mode = PlasmaFlatHouseholder;
 
+    // The tile memory pool is disabled until PlasmaPoolSize is set.
+    plasma_pool_init(&context->pool);
+
+    // Tiles are placed by whichever task touches them first, unless set.
+    // Each OpenMP place counts as a socket, which is exact for
+    // OMP_PLACES=sockets.
+    context->placement = PlasmaPlacementNone;
+    context->num_sockets = omp_get_num_places() > 0 ?
+                           omp_get_num_places() : 1;
+
+    // Tasks run on any thread, not on the socket of their output tile,
+    // unless set. Setting it has no effect unless the tiles are placed
+    // on more than one socket.
+    context->affinity = PlasmaDisabled;
+    plasma_dispatch_init(&context->dispatch);
+
+    // Descriptors get a table of tile addresses, unless disabled.
+    context->tile_table = PlasmaEnabled;
+
+    // The next panel and its updates run first, unless set.
+    context->lookahead = 1;
+
+    // Calls create their tasks each time, unless recording is enabled.
+    context->task_graph = PlasmaDisabled;
+    context->graphs = NULL;
+
+    // Sequences are not counted, unless enabled.
+    context->stats = PlasmaDisabled;
+    memset(&context->stats_total, 0, sizeof(plasma_stats_t));
+
+    // Per-thread scratch is allocated on first use and kept across calls.
+    plasma_workspace_create(&context->work, 0, PlasmaByte);
+
+    // The thread running async calls is started by the first one.
+    plasma_runtime_init(&context->runtime);
+
+    // Tasks are traced if built with it and PLASMA_TRACE is set.
+    plasma_trace_init();
+
     // Initialize config.
     context->L = plasma_tuning_init();
+    plasma_tuning_cache_init(context);
 }
 
 /******************************************************************************/
 void plasma_context_finalize(plasma_context_t *context)
 {
+    // Complete the async calls, which use the pool and the tuning.
+    plasma_runtime_finalize(&context->runtime);
+
     // Finalize config.
+    plasma_tuning_cache_finalize(context);
     plasma_tuning_finalize(context->L);
+
+    // Free the cached tile buffers.
+    plasma_pool_finalize(&context->pool);
+
+    // Free the per-thread scratch.
+    plasma_workspace_destroy(&context->work);
+
+    // Free the recorded calls.
+    plasma_graph_cache_clear(&context->graphs);
+
+    plasma_dispatch_finalize(&context->dispatch);
+
+    if (context->stats == PlasmaEnabled)
+        __sync_fetch_and_sub(&plasma_stats_enabled, 1);
 }
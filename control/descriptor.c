@@ -11,6 +11,45 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_memory.h"
+#include "plasma_trace.h"
+
+#include <string.h>
+
+#include <omp.h>
+
+/******************************************************************************/
+// Builds the table of tile addresses and leading dimensions of A,
+// so that plasma_tile_addr() and plasma_tile_mmain() need no divisions.
+// The table is optional; without memory for it A is left without one.
+static void plasma_desc_tiles_create(plasma_desc_t *A)
+{
+    plasma_tile_t *tiles =
+        (plasma_tile_t*)malloc((size_t)A->gmt*A->gnt*sizeof(plasma_tile_t));
+    if (tiles == NULL)
+        return;
+
+    plasma_desc_t B = *A;
+    B.i = 0;
+    B.j = 0;
+    for (int n = 0; n < A->gnt; n++) {
+        for (int m = 0; m < A->gmt; m++) {
+            plasma_tile_t *tile = &tiles[m + (size_t)A->gmt*n];
+            tile->addr = plasma_tile_addr_general(B, m, n);
+            tile->ld = m < A->gm/A->mb ? A->mb : A->gm%A->mb;
+        }
+    }
+    A->tiles = tiles + A->i/A->mb + (size_t)A->gmt*(A->j/A->nb);
+}
+
+/******************************************************************************/
+static void plasma_desc_tiles_destroy(plasma_desc_t *A)
+{
+    if (A->tiles != NULL) {
+        free(A->tiles - A->i/A->mb - (size_t)A->gmt*(A->j/A->nb));
+        A->tiles = NULL;
+    }
+}
 
 /******************************************************************************/
 int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
@@ -38,11 +77,22 @@ int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
     // Allocate the matrix.
     size_t size = (size_t)A->gm*A->gn*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
+    int fresh;
+    A->matrix = plasma_pool_alloc(&plasma->pool, size, &fresh);
     if (A->matrix == NULL) {
         plasma_error("malloc() failed");
         return PlasmaErrorOutOfMemory;
     }
+    // Place the tiles of fresh memory by touching them first.
+    // Their sockets then own them, for PlasmaTaskAffinity.
+    if (fresh && plasma->placement != PlasmaPlacementNone) {
+        plasma_desc_place(*A, plasma->placement, plasma->num_sockets);
+        plasma_dispatch_add(&plasma->dispatch, *A, plasma->placement,
+                            imin(plasma->num_sockets, plasma->max_threads));
+    }
+
+    if (plasma->tile_table == PlasmaEnabled)
+        plasma_desc_tiles_create(A);
     return PlasmaSuccess;
 }
 
@@ -73,14 +123,64 @@ int plasma_desc_general_band_create(plasma_enum_t precision, plasma_enum_t uplo,
     // Allocate the matrix.
     size_t size = (size_t)A->gm*A->gn*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
+    int fresh;
+    A->matrix = plasma_pool_alloc(&plasma->pool, size, &fresh);
     if (A->matrix == NULL) {
         plasma_error("malloc() failed");
         return PlasmaErrorOutOfMemory;
     }
+    // Place the tiles of fresh memory by touching them first.
+    // Their sockets then own them, for PlasmaTaskAffinity.
+    if (fresh && plasma->placement != PlasmaPlacementNone) {
+        plasma_desc_place(*A, plasma->placement, plasma->num_sockets);
+        plasma_dispatch_add(&plasma->dispatch, *A, plasma->placement,
+                            imin(plasma->num_sockets, plasma->max_threads));
+    }
+
+    if (plasma->tile_table == PlasmaEnabled)
+        plasma_desc_tiles_create(A);
     return PlasmaSuccess;
 }
 
+/******************************************************************************/
+int plasma_desc_general_inplace_create(plasma_enum_t precision,
+                                       void *pA, int lda,
+                                       int mb, int nb, int lm, int ln,
+                                       int i, int j, int m, int n,
+                                       plasma_desc_t *A)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    // Store the tiles in pA itself if it holds exactly the tile matrix.
+    // Otherwise, or if the translation workspace cannot be allocated,
+    // the tiles are stored separately.
+    if (plasma->inplace_outplace == PlasmaInplace && pA != NULL &&
+        lda == lm && i == 0 && j == 0 && m == lm && n == ln) {
+        int retval = plasma_desc_general_init(precision, pA, mb, nb,
+                                              lm, ln, i, j, m, n, A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_init() failed");
+            return retval;
+        }
+        retval = plasma_desc_check(*A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_check() failed");
+            return PlasmaErrorIllegalValue;
+        }
+        A->inplace = plasma_desc_inplace_create(*A);
+        if (A->inplace != NULL) {
+            if (plasma->tile_table == PlasmaEnabled)
+                plasma_desc_tiles_create(A);
+            return PlasmaSuccess;
+        }
+    }
+    return plasma_desc_general_create(precision, mb, nb,
+                                      lm, ln, i, j, m, n, A);
+}
+
 /******************************************************************************/
 int plasma_desc_destroy(plasma_desc_t *A)
 {
@@ -89,7 +189,20 @@ int plasma_desc_destroy(plasma_desc_t *A)
         plasma_error("PLASMA not initialized");
         return PlasmaErrorNotInitialized;
     }
-    free(A->matrix);
+    plasma_desc_tiles_destroy(A);
+
+    // The array of a LAPACK layout descriptor belongs to the caller.
+    if (A->type == PlasmaGeneralLapack)
+        return PlasmaSuccess;
+
+    // The tiles of an in-place descriptor belong to the caller.
+    if (A->inplace != NULL) {
+        free(A->inplace);
+        A->inplace = NULL;
+        return PlasmaSuccess;
+    }
+    plasma_dispatch_remove(&plasma->dispatch, A->matrix);
+    plasma_pool_free(&plasma->pool, A->matrix);
     return PlasmaSuccess;
 }
 
@@ -104,6 +217,8 @@ int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
 
     // pointer and offsets
     A->matrix = matrix;
+    A->inplace = NULL;
+    A->tiles = NULL;
     A->A21 = (size_t)(lm - lm%mb) * (ln - ln%nb);
     A->A12 = (size_t)(     lm%mb) * (ln - ln%nb) + A->A21;
     A->A22 = (size_t)(lm - lm%mb) * (     ln%nb) + A->A12;
@@ -169,6 +284,25 @@ int plasma_desc_general_band_init(plasma_enum_t precision, plasma_enum_t uplo,
     return PlasmaSuccess;
 }
 
+/******************************************************************************/
+int plasma_desc_general_lapack_init(plasma_enum_t precision, void *matrix,
+                                    int ld, int mb, int nb, int lm, int ln,
+                                    int i, int j, int m, int n,
+                                    plasma_desc_t *A)
+{
+    // Init parameters for a general matrix.
+    int retval = plasma_desc_general_init(precision, matrix, mb, nb,
+                                          lm, ln, i, j, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    // Change matrix type to LAPACK layout.
+    A->type = PlasmaGeneralLapack;
+    A->ld = ld;
+    return PlasmaSuccess;
+}
+
 /******************************************************************************/
 int plasma_desc_check(plasma_desc_t A)
 {
@@ -178,6 +312,9 @@ int plasma_desc_check(plasma_desc_t A)
     else if (A.type == PlasmaGeneralBand) {
         return plasma_desc_general_band_check(A);
     }
+    else if (A.type == PlasmaGeneralLapack) {
+        return plasma_desc_general_lapack_check(A);
+    }
     else {
         plasma_error("invalid matrix type");
         return PlasmaErrorIllegalValue;
@@ -274,6 +411,20 @@ int plasma_desc_general_band_check(plasma_desc_t A)
     return PlasmaSuccess;
 }
 
+/******************************************************************************/
+int plasma_desc_general_lapack_check(plasma_desc_t A)
+{
+    int retval = plasma_desc_general_check(A);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (A.ld < imax(1, A.gm)) {
+        plasma_error("invalid leading dimension");
+        return PlasmaErrorIllegalValue;
+    }
+    return PlasmaSuccess;
+}
+
 /******************************************************************************/
 plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n)
 {
@@ -297,6 +448,11 @@ plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n)
     B.mt = (m == 0) ? 0 : (B.i+m-1)/mb - B.i/mb + 1;
     B.nt = (n == 0) ? 0 : (B.j+n-1)/nb - B.j/nb + 1;
 
+    // shared tile table
+    if (A.tiles != NULL)
+        B.tiles = A.tiles + (B.i/mb - A.i/mb) +
+                  (size_t)A.gmt*(B.j/nb - A.j/nb);
+
     return B;
 }
 
@@ -326,3 +482,528 @@ int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
                                             0, 0, m, n, T);
     return retval;
 }
+
+/******************************************************************************/
+// Returns the socket that tile (m, n) of the entire matrix is placed on.
+int plasma_desc_tile_socket(plasma_desc_t A, plasma_enum_t placement,
+                            int num_sockets, int m, int n)
+{
+    switch (placement) {
+    case PlasmaPlacementColumnCyclic:
+        return n % num_sockets;
+    case PlasmaPlacementSocketCyclic: {
+        // Arrange the sockets in a p-by-q grid, as square as possible.
+        int p = 1;
+        for (int i = 1; i*i <= num_sockets; i++)
+            if (num_sockets % i == 0)
+                p = i;
+        int q = num_sockets/p;
+        return (m%p)*q + n%q;
+    }
+    case PlasmaPlacementInterleave:
+        return (int)(((size_t)A.gmt*n + m) % num_sockets);
+    default:
+        return 0;
+    }
+}
+
+/******************************************************************************/
+void plasma_desc_place(plasma_desc_t A, plasma_enum_t placement,
+                       int num_sockets)
+{
+    // Address tiles of the entire matrix.
+    A.i = 0;
+    A.j = 0;
+    size_t eltsize = plasma_element_size(A.precision);
+
+    #pragma omp parallel
+    {
+        // The same sockets as those running the tasks of their tiles.
+        int nthread = omp_get_num_threads();
+        int tid = omp_get_thread_num();
+        int nsocket = imax(1, imin(num_sockets, nthread));
+        int socket = plasma_thread_socket(num_sockets);
+        int first = (socket*nthread + nsocket-1)/nsocket;
+        int last = ((socket+1)*nthread + nsocket-1)/nsocket;
+
+        // Touch the tiles of this socket, spread over its threads.
+        for (int n = 0; n < A.gnt; n++) {
+            for (int m = 0; m < A.gmt; m++) {
+                if (plasma_desc_tile_socket(A, placement, nsocket, m, n)
+                    == socket && (m+n) % (last-first) == tid-first) {
+                    memset(plasma_tile_addr_general(A, m, n), 0,
+                           (size_t)plasma_tile_mmain(A, m)*
+                           plasma_tile_nmain(A, n)*eltsize);
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Workspace of the in-place translation of a descriptor, followed by
+// the workspaces of the tasks translating block columns and one shared
+// workspace for the whole matrix.
+typedef struct {
+    int num_slots;      // number of block column workspaces
+    size_t tail_size;   // bytes of the partial tile row of a block column
+    size_t buf_size;    // bytes of the two units being moved
+    size_t done_size;   // bytes of the bitmap of units already moved
+    size_t slot_size;   // bytes of a block column workspace
+    size_t unit;        // elements of a unit moved by the shared workspace
+} plasma_inplace_t;
+
+// Rounds size up to a cache line.
+static size_t plasma_inplace_align(size_t size)
+{
+    return (size+63)/64*64;
+}
+
+static size_t plasma_inplace_gcd(size_t a, size_t b)
+{
+    while (b != 0) {
+        size_t r = a%b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/******************************************************************************/
+void *plasma_desc_inplace_create(plasma_desc_t A)
+{
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t m1 = A.gm - A.gm%A.mb;
+    size_t m2 = A.gm%A.mb;
+    size_t n1 = A.gn - A.gn%A.nb;
+
+    plasma_inplace_t layout;
+    layout.num_slots = omp_get_max_threads();
+
+    // A block column moves its partial tile row aside
+    // and transposes its full tiles by units of mb elements.
+    layout.tail_size = plasma_inplace_align(m2*A.nb*eltsize);
+    layout.buf_size = plasma_inplace_align(2*A.mb*eltsize);
+    layout.done_size = plasma_inplace_align((m1/A.mb*A.nb+7)/8);
+    layout.slot_size =
+        layout.tail_size + layout.buf_size + layout.done_size;
+
+    // The whole matrix gathers the partial tile rows of the block columns
+    // by units dividing both the full and the partial tiles of a column.
+    layout.unit = plasma_inplace_gcd(m1, m2)*A.nb;
+    size_t num_units = layout.unit > 0 ? (m1+m2)*n1/layout.unit : 0;
+    size_t shared_size =
+        plasma_inplace_align(2*layout.unit*eltsize) +
+        plasma_inplace_align((num_units+7)/8);
+
+    size_t size = plasma_inplace_align(sizeof(plasma_inplace_t)) +
+                  layout.num_slots*layout.slot_size + shared_size;
+    plasma_inplace_t *work = (plasma_inplace_t*)malloc(size);
+    if (work != NULL)
+        *work = layout;
+    return work;
+}
+
+/******************************************************************************/
+// Moves each unit u of size bytes at base to position map(u, arg),
+// following the cycles of the permutation of the num units.
+// done is a bitmap of num bits, buf holds two units.
+typedef size_t (*plasma_inplace_map_t)(size_t u, const size_t *arg);
+
+static void plasma_inplace_permute(char *base, size_t num, size_t size,
+                                   plasma_inplace_map_t map, const size_t *arg,
+                                   unsigned char *done, char *buf)
+{
+    memset(done, 0, (num+7)/8);
+    char *src = buf;
+    char *dst = buf+size;
+    for (size_t first = 0; first < num; first++) {
+        if (done[first/8] & (1 << first%8))
+            continue;
+
+        size_t u = first;
+        memcpy(src, base+u*size, size);
+        do {
+            u = map(u, arg);
+            memcpy(dst, base+u*size, size);
+            memcpy(base+u*size, src, size);
+            done[u/8] |= 1 << u%8;
+            char *tmp = src;
+            src = dst;
+            dst = tmp;
+        } while (u != first);
+    }
+}
+
+// Transposes an arg[0]-by-arg[1] matrix of units stored by columns.
+static size_t plasma_inplace_transpose(size_t u, const size_t *arg)
+{
+    return u/arg[0] + u%arg[0]*arg[1];
+}
+
+// Gathers arg[2] records of arg[0] units followed by arg[1] units
+// into all the leading parts followed by all the trailing parts.
+static size_t plasma_inplace_unshuffle(size_t u, const size_t *arg)
+{
+    size_t a = arg[0], b = arg[1], k = arg[2];
+    size_t q = u/(a+b);
+    size_t r = u%(a+b);
+    return r < a ? q*a + r : k*a + q*b + r-a;
+}
+
+// Inverse of plasma_inplace_unshuffle().
+static size_t plasma_inplace_shuffle(size_t u, const size_t *arg)
+{
+    size_t a = arg[0], b = arg[1], k = arg[2];
+    if (u < k*a)
+        return u/a*(a+b) + u%a;
+    u -= k*a;
+    return u/b*(a+b) + a + u%b;
+}
+
+/******************************************************************************/
+// Translates block column k of A between LAPACK layout and a column
+// of tiles, with its partial tile last, using block column workspace slot.
+static void plasma_desc_inplace_column(plasma_desc_t A, plasma_inplace_t *work,
+                                       int slot, int k, int to_tile)
+{
+    char *tail = (char*)work + plasma_inplace_align(sizeof(plasma_inplace_t))
+                             + slot*work->slot_size;
+    char *buf = tail + work->tail_size;
+    unsigned char *done = (unsigned char*)buf + work->buf_size;
+
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t ld = (size_t)A.gm*eltsize;
+    size_t m1 = (size_t)(A.gm - A.gm%A.mb)*eltsize;
+    size_t m2 = (size_t)(A.gm%A.mb)*eltsize;
+    size_t lm1 = A.gm/A.mb;
+    size_t w = plasma_tile_nmain(A, k);
+    char *pA = (char*)A.matrix + (size_t)A.nb*k*ld;
+
+    size_t arg[2];
+    if (to_tile) {
+        // Move the partial tile row after the full tiles.
+        if (m1 > 0 && m2 > 0) {
+            for (size_t j = 0; j < w; j++)
+                memcpy(tail + j*m2, pA + j*ld + m1, m2);
+            for (size_t j = 1; j < w; j++)
+                memmove(pA + j*m1, pA + j*ld, m1);
+            memcpy(pA + w*m1, tail, w*m2);
+        }
+        // Gather each full tile from its columns.
+        if (lm1 > 1 && w > 1) {
+            arg[0] = lm1;
+            arg[1] = w;
+            plasma_inplace_permute(pA, lm1*w, A.mb*eltsize,
+                                   plasma_inplace_transpose, arg, done, buf);
+        }
+    }
+    else {
+        if (lm1 > 1 && w > 1) {
+            arg[0] = w;
+            arg[1] = lm1;
+            plasma_inplace_permute(pA, lm1*w, A.mb*eltsize,
+                                   plasma_inplace_transpose, arg, done, buf);
+        }
+        if (m1 > 0 && m2 > 0) {
+            memcpy(tail, pA + w*m1, w*m2);
+            for (size_t j = w-1; j > 0; j--)
+                memmove(pA + j*ld, pA + j*m1, m1);
+            for (size_t j = 0; j < w; j++)
+                memcpy(pA + j*ld + m1, tail + j*m2, m2);
+        }
+    }
+}
+
+/******************************************************************************/
+// Moves the partial tiles of the full block columns of A between
+// the end of each block column (to_tile false) and the A21 part of
+// the tile layout (to_tile true).
+static void plasma_desc_inplace_matrix(plasma_desc_t A, plasma_inplace_t *work,
+                                       int to_tile,
+                                       plasma_sequence_t *sequence)
+{
+    size_t m1 = A.gm - A.gm%A.mb;
+    size_t m2 = A.gm%A.mb;
+    size_t ln1 = A.gn/A.nb;
+    if (m1 == 0 || m2 == 0 || ln1 < 2)
+        return;
+
+    char *buf = (char*)work + plasma_inplace_align(sizeof(plasma_inplace_t))
+                            + work->num_slots*work->slot_size;
+    size_t size = work->unit*plasma_element_size(A.precision);
+    unsigned char *done =
+        (unsigned char*)buf + plasma_inplace_align(2*size);
+
+    size_t arg[3];
+    arg[0] = m1*A.nb/work->unit;
+    arg[1] = m2*A.nb/work->unit;
+    arg[2] = ln1;
+    PLASMA_TRACE_START();
+    plasma_inplace_permute((char*)A.matrix, (arg[0]+arg[1])*ln1, size,
+                           to_tile ? plasma_inplace_unshuffle
+                                   : plasma_inplace_shuffle,
+                           arg, done, buf);
+    PLASMA_TRACE_TRANSLATION(__func__, sequence,
+                             {A.matrix, A.matrix, PlasmaGraphNone});
+}
+
+/******************************************************************************/
+void plasma_desc_ge2desc_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence)
+{
+    plasma_inplace_t *work = (plasma_inplace_t*)A.inplace;
+
+    // Block columns are independent. Each task translates every
+    // num_slots-th block column in its own workspace, which works
+    // whichever team, and however many threads, runs the tasks.
+    int num_slots = imin(work->num_slots, A.gnt);
+    for (int slot = 0; slot < num_slots; slot++) {
+        #pragma omp task
+        {
+            PLASMA_TRACE_START();
+            for (int k = slot; k < A.gnt; k += num_slots)
+                plasma_desc_inplace_column(A, work, slot, k, 1);
+            PLASMA_TRACE_TRANSLATION(__func__, sequence,
+                                     {A.matrix, A.matrix, PlasmaGraphNone});
+        }
+    }
+    #pragma omp taskwait
+
+    plasma_desc_inplace_matrix(A, work, 1, sequence);
+}
+
+/******************************************************************************/
+void plasma_desc_desc2ge_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence)
+{
+    plasma_inplace_t *work = (plasma_inplace_t*)A.inplace;
+
+    // Wait for all tasks using the tiles.
+    #pragma omp taskwait
+
+    plasma_desc_inplace_matrix(A, work, 0, sequence);
+
+    int num_slots = imin(work->num_slots, A.gnt);
+    for (int slot = 0; slot < num_slots; slot++) {
+        #pragma omp task
+        {
+            PLASMA_TRACE_START();
+            for (int k = slot; k < A.gnt; k += num_slots)
+                plasma_desc_inplace_column(A, work, slot, k, 0);
+            PLASMA_TRACE_TRANSLATION(__func__, sequence,
+                                     {A.matrix, A.matrix, PlasmaGraphNone});
+        }
+    }
+    #pragma omp taskwait
+}
+
+/******************************************************************************/
+int plasma_desc_pool_stats(plasma_pool_stats_t *stats)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (stats == NULL) {
+        plasma_error("NULL stats");
+        return PlasmaErrorNullParameter;
+    }
+    pthread_mutex_lock(&plasma->pool.lock);
+    *stats = plasma->pool.stats;
+    pthread_mutex_unlock(&plasma->pool.lock);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+int plasma_desc_pool_trim()
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    // Free all cached buffers, keeping the configured size.
+    size_t max_size = plasma->pool.max_size;
+    plasma_pool_set_size(&plasma->pool, 0);
+    plasma_pool_set_size(&plasma->pool, max_size);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_pool_init(plasma_pool_t *pool)
+{
+    memset(pool, 0, sizeof(plasma_pool_t));
+    pool->trim = PlasmaPoolTrimOldest;
+    pool->huge_pages = PlasmaDisabled;
+    pthread_mutex_init(&pool->lock, NULL);
+}
+
+/******************************************************************************/
+void plasma_pool_finalize(plasma_pool_t *pool)
+{
+    // Live buffers are not freed, since descriptors may outlive the context.
+    for (int i = 0; i < pool->num_cached; i++)
+        free(pool->cached[i].matrix);
+
+    free(pool->cached);
+    free(pool->live);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+/******************************************************************************/
+// Rounds size up to a multiple of 1/16 to 1/8 of its leading power of two,
+// and to at least a page, which bounds the waste to 12.5%.
+static size_t plasma_pool_class(size_t size)
+{
+    size_t step = 4096;
+    while (step*16 <= size)
+        step *= 2;
+
+    return (size+step-1)/step*step;
+}
+
+/******************************************************************************/
+// Appends a block to a list, doubling the list if out of space.
+static int plasma_pool_push(plasma_pool_block_t **list, int *num, int *max,
+                            plasma_pool_block_t block)
+{
+    if (*num == *max) {
+        int max_new = *max == 0 ? 16 : 2*(*max);
+        plasma_pool_block_t *list_new = (plasma_pool_block_t*)realloc(
+            *list, max_new*sizeof(plasma_pool_block_t));
+        if (list_new == NULL)
+            return PlasmaErrorOutOfMemory;
+
+        *list = list_new;
+        *max = max_new;
+    }
+    (*list)[(*num)++] = block;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Frees the least recently released buffers until max_size bytes remain.
+// Called with the lock held.
+static void plasma_pool_shrink(plasma_pool_t *pool, size_t max_size)
+{
+    while (pool->stats.size > max_size) {
+        int oldest = 0;
+        for (int i = 1; i < pool->num_cached; i++)
+            if (pool->cached[i].age < pool->cached[oldest].age)
+                oldest = i;
+
+        free(pool->cached[oldest].matrix);
+        pool->stats.size -= pool->cached[oldest].size;
+        pool->stats.evictions++;
+        pool->cached[oldest] = pool->cached[--pool->num_cached];
+    }
+    pool->stats.num_blocks = pool->num_cached;
+}
+
+/******************************************************************************/
+void *plasma_pool_alloc(plasma_pool_t *pool, size_t size, int *fresh)
+{
+    size_t size_class = plasma_pool_class(size);
+    *fresh = 1;
+
+    pthread_mutex_lock(&pool->lock);
+
+    // Plain malloc() if the pool is disabled.
+    if (pool->max_size == 0) {
+        pool->stats.misses++;
+        pthread_mutex_unlock(&pool->lock);
+        return plasma_memory_alloc(size, pool->huge_pages);
+    }
+    // Take the most recently released buffer of the size class,
+    // which is the most likely to still be in cache.
+    plasma_pool_block_t block = { NULL, size_class, 0 };
+    int found = -1;
+    for (int i = 0; i < pool->num_cached; i++)
+        if (pool->cached[i].size == size_class &&
+            (found < 0 || pool->cached[i].age > pool->cached[found].age))
+            found = i;
+
+    if (found >= 0) {
+        block.matrix = pool->cached[found].matrix;
+        pool->cached[found] = pool->cached[--pool->num_cached];
+        pool->stats.size -= size_class;
+        pool->stats.num_blocks = pool->num_cached;
+        pool->stats.hits++;
+        *fresh = 0;
+    }
+    else {
+        block.matrix = plasma_memory_alloc(size_class, pool->huge_pages);
+        if (block.matrix == NULL) {
+            pthread_mutex_unlock(&pool->lock);
+            return NULL;
+        }
+        pool->stats.misses++;
+    }
+    // Track the buffer, so that it can be told from foreign ones on release.
+    if (plasma_pool_push(&pool->live, &pool->num_live, &pool->max_live,
+                         block) != PlasmaSuccess) {
+        free(block.matrix);
+        block.matrix = NULL;
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return block.matrix;
+}
+
+/******************************************************************************/
+void plasma_pool_free(plasma_pool_t *pool, void *matrix)
+{
+    if (matrix == NULL)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+
+    // Find the buffer among the live ones.
+    int found = -1;
+    for (int i = pool->num_live-1; i >= 0; i--) {
+        if (pool->live[i].matrix == matrix) {
+            found = i;
+            break;
+        }
+    }
+    // Not allocated by the pool.
+    if (found < 0) {
+        pthread_mutex_unlock(&pool->lock);
+        free(matrix);
+        return;
+    }
+    plasma_pool_block_t block = pool->live[found];
+    pool->live[found] = pool->live[--pool->num_live];
+
+    // Free the buffer if it does not fit, or make room for it.
+    if (block.size > pool->max_size ||
+        (pool->trim == PlasmaPoolTrimNewest &&
+         pool->stats.size+block.size > pool->max_size)) {
+        pthread_mutex_unlock(&pool->lock);
+        free(matrix);
+        return;
+    }
+    plasma_pool_shrink(pool, pool->max_size-block.size);
+
+    // Cache the buffer.
+    block.age = ++pool->clock;
+    if (plasma_pool_push(&pool->cached, &pool->num_cached, &pool->max_cached,
+                         block) != PlasmaSuccess) {
+        pthread_mutex_unlock(&pool->lock);
+        free(matrix);
+        return;
+    }
+    pool->stats.size += block.size;
+    pool->stats.num_blocks = pool->num_cached;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/******************************************************************************/
+void plasma_pool_set_size(plasma_pool_t *pool, size_t max_size)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->max_size = max_size;
+    plasma_pool_shrink(pool, max_size);
+    pthread_mutex_unlock(&pool->lock);
+}
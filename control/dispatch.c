@@ -0,0 +1,248 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_dispatch.h"
+#include "plasma_barrier.h"
+#include "plasma_internal.h"
+
+#include <omp.h>
+#include <sched.h>
+
+// number of polls of the queue of its socket by a thread whose kernel waits
+// for the owner socket, before yielding the processor
+static const int MaxSpins = 1024;
+
+// number of yields of the processor before the thread takes the kernel back
+static const int MaxYields = 16;
+
+/******************************************************************************/
+void plasma_dispatch_init(plasma_dispatch_t *dispatch)
+{
+    pthread_mutex_init(&dispatch->lock, NULL);
+    dispatch->num_matrices = 0;
+    for (int i = 0; i < PLASMA_DISPATCH_MAX_SOCKETS; i++) {
+        pthread_mutex_init(&dispatch->queues[i].lock, NULL);
+        dispatch->queues[i].head = NULL;
+    }
+}
+
+/******************************************************************************/
+void plasma_dispatch_finalize(plasma_dispatch_t *dispatch)
+{
+    pthread_mutex_destroy(&dispatch->lock);
+    for (int i = 0; i < PLASMA_DISPATCH_MAX_SOCKETS; i++)
+        pthread_mutex_destroy(&dispatch->queues[i].lock);
+}
+
+/******************************************************************************/
+// Registers a matrix just placed, unless there are too many already,
+// in which case its tiles have no owner.
+void plasma_dispatch_add(plasma_dispatch_t *dispatch, plasma_desc_t A,
+                         plasma_enum_t placement, int num_sockets)
+{
+    if (num_sockets <= 1)
+        return;
+
+    size_t size = (size_t)A.gm*A.gn*plasma_element_size(A.precision);
+    pthread_mutex_lock(&dispatch->lock);
+    if (dispatch->num_matrices < PLASMA_DISPATCH_MAX_MATRICES) {
+        plasma_dispatch_matrix_t *matrix =
+            &dispatch->matrices[dispatch->num_matrices++];
+        matrix->begin = (const char*)A.matrix;
+        matrix->end = matrix->begin+size;
+        matrix->A = A;
+        matrix->A.tiles = NULL;
+        matrix->placement = placement;
+        matrix->num_sockets = imin(num_sockets, PLASMA_DISPATCH_MAX_SOCKETS);
+    }
+    pthread_mutex_unlock(&dispatch->lock);
+}
+
+/******************************************************************************/
+void plasma_dispatch_remove(plasma_dispatch_t *dispatch, const void *matrix)
+{
+    pthread_mutex_lock(&dispatch->lock);
+    for (int i = 0; i < dispatch->num_matrices; i++) {
+        if (dispatch->matrices[i].begin == (const char*)matrix) {
+            dispatch->matrices[i] =
+                dispatch->matrices[--dispatch->num_matrices];
+            break;
+        }
+    }
+    pthread_mutex_unlock(&dispatch->lock);
+}
+
+/******************************************************************************/
+// Returns the socket owning the tile at the address, and the number of
+// sockets its matrix was placed on, or -1 if the tile is not in a placed
+// matrix. The tile is found from its offset, the inverse of
+// plasma_tile_addr_general().
+static int plasma_dispatch_owner(plasma_dispatch_t *dispatch,
+                                 const void *tile, int *num_sockets)
+{
+    const char *addr = (const char*)tile;
+    int socket = -1;
+    pthread_mutex_lock(&dispatch->lock);
+    for (int i = 0; i < dispatch->num_matrices; i++) {
+        plasma_dispatch_matrix_t *matrix = &dispatch->matrices[i];
+        if (addr < matrix->begin || addr >= matrix->end)
+            continue;
+
+        plasma_desc_t A = matrix->A;
+        size_t offset = (size_t)(addr-matrix->begin)/
+                        plasma_element_size(A.precision);
+        int lm1 = A.gm/A.mb;
+        int ln1 = A.gn/A.nb;
+        int m, n;
+        if (offset < A.A21) {
+            size_t t = offset/((size_t)A.mb*A.nb);
+            m = (int)(t%lm1);
+            n = (int)(t/lm1);
+        }
+        else if (offset < A.A12) {
+            m = lm1;
+            n = (int)((offset-A.A21)/((size_t)A.nb*(A.gm%A.mb)));
+        }
+        else if (offset < A.A22) {
+            m = (int)((offset-A.A12)/((size_t)A.mb*(A.gn%A.nb)));
+            n = ln1;
+        }
+        else {
+            m = lm1;
+            n = ln1;
+        }
+        *num_sockets = matrix->num_sockets;
+        socket = plasma_desc_tile_socket(A, matrix->placement,
+                                         matrix->num_sockets, m, n);
+        break;
+    }
+    pthread_mutex_unlock(&dispatch->lock);
+    return socket;
+}
+
+/******************************************************************************/
+// Returns the socket of the calling thread in its team. Threads of a
+// socket are assumed consecutive, as with OMP_PROC_BIND=close.
+int plasma_thread_socket(int num_sockets)
+{
+    int nthread = omp_get_num_threads();
+    int nsocket = imax(1, imin(num_sockets, nthread));
+    return omp_get_thread_num()*nsocket/nthread;
+}
+
+/******************************************************************************/
+// Takes the task of highest priority off the queue.
+static plasma_dispatch_task_t *plasma_dispatch_pop(
+    plasma_dispatch_queue_t *queue)
+{
+    pthread_mutex_lock(&queue->lock);
+    plasma_dispatch_task_t *task = queue->head;
+    if (task != NULL)
+        queue->head = task->next;
+    pthread_mutex_unlock(&queue->lock);
+    return task;
+}
+
+/******************************************************************************/
+// Takes the task off the queue, unless another thread took it already.
+static int plasma_dispatch_unlink(plasma_dispatch_queue_t *queue,
+                                  plasma_dispatch_task_t *task)
+{
+    pthread_mutex_lock(&queue->lock);
+    plasma_dispatch_task_t **next = &queue->head;
+    while (*next != NULL && *next != task)
+        next = &(*next)->next;
+    int found = *next == task;
+    if (found)
+        *next = task->next;
+    pthread_mutex_unlock(&queue->lock);
+    return found;
+}
+
+/******************************************************************************/
+static void plasma_dispatch_exec(plasma_dispatch_task_t *task)
+{
+    task->run(task);
+    __sync_synchronize();
+    task->done = 1;
+}
+
+/***************************************************************************//**
+ *  Runs a kernel on the socket owning its output tile, if PlasmaTaskAffinity
+ *  is enabled and the tile was placed. Called by the OpenMP task of the
+ *  kernel, which returns once the kernel has run, so that the dependencies
+ *  of the task are released as usual.
+ *
+ *  Threads first run the kernels queued for their socket by the other
+ *  sockets. A kernel of another socket is queued there, by priority, and
+ *  the calling thread keeps running the kernels queued for its own socket
+ *  meanwhile, and yields the processor to them, in case the threads share
+ *  it. If none comes for a while, it takes its kernel back and runs it
+ *  itself, unless a thread of the owner socket has taken it already.
+ ******************************************************************************/
+void plasma_dispatch(plasma_dispatch_t *dispatch, const void *tile,
+                     plasma_dispatch_task_t *task)
+{
+    int num_sockets = 1;
+    int socket = dispatch == NULL ?
+                 -1 : plasma_dispatch_owner(dispatch, tile, &num_sockets);
+    if (socket < 0) {
+        task->run(task);
+        return;
+    }
+
+    int self = plasma_thread_socket(num_sockets);
+    plasma_dispatch_task_t *other;
+    while ((other = plasma_dispatch_pop(&dispatch->queues[self])) != NULL)
+        plasma_dispatch_exec(other);
+
+    if (socket == self) {
+        task->run(task);
+        return;
+    }
+
+    // Queue after the tasks of higher or the same priority.
+    plasma_dispatch_queue_t *queue = &dispatch->queues[socket];
+    task->done = 0;
+    pthread_mutex_lock(&queue->lock);
+    plasma_dispatch_task_t **next = &queue->head;
+    while (*next != NULL && (*next)->priority >= task->priority)
+        next = &(*next)->next;
+    task->next = *next;
+    *next = task;
+    pthread_mutex_unlock(&queue->lock);
+
+    int spins = 0;
+    int yields = 0;
+    while (!task->done) {
+        other = plasma_dispatch_pop(&dispatch->queues[self]);
+        if (other != NULL) {
+            plasma_dispatch_exec(other);
+            spins = 0;
+            yields = 0;
+        }
+        else if (spins < MaxSpins) {
+            plasma_barrier_pause();
+            spins++;
+        }
+        else if (yields < MaxYields) {
+            sched_yield();
+            yields++;
+        }
+        else if (plasma_dispatch_unlink(queue, task)) {
+            plasma_dispatch_exec(task);
+        }
+        else {
+            // A thread of the owner socket is running it.
+            sched_yield();
+        }
+    }
+    __sync_synchronize();
+}
@@ -0,0 +1,460 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_graph.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+// Tasks accessing a tile since the last task writing it, while recording.
+typedef struct plasma_graph_tile_s {
+    int used;        ///< whether the slot holds a tile
+    int desc;        ///< descriptor of the tile
+    size_t offset;   ///< byte offset of the tile in the descriptor
+    int writer;      ///< last task writing the tile, -1 if none
+    int *readers;    ///< tasks reading the tile since
+    int num_readers; ///< number of readers
+    int max_readers; ///< allocated number of readers
+} plasma_graph_tile_t;
+
+/******************************************************************************/
+// Returns whether two descriptors have the same tile layout and submatrix.
+static int plasma_graph_desc_match(const plasma_desc_t *a,
+                                   const plasma_desc_t *b)
+{
+    return a->type == b->type && a->uplo == b->uplo &&
+           a->precision == b->precision &&
+           a->A21 == b->A21 && a->A12 == b->A12 && a->A22 == b->A22 &&
+           a->ld == b->ld && a->mb == b->mb && a->nb == b->nb &&
+           a->gm == b->gm && a->gn == b->gn &&
+           a->i == b->i && a->j == b->j && a->m == b->m && a->n == b->n &&
+           a->kl == b->kl && a->ku == b->ku;
+}
+
+/******************************************************************************/
+// Returns the number of bytes holding the tiles of a descriptor.
+static size_t plasma_graph_desc_extent(const plasma_desc_t *A)
+{
+    size_t lm = A->type == PlasmaGeneralLapack ? A->ld : A->gm;
+    return lm*A->gn*plasma_element_size(A->precision);
+}
+
+/******************************************************************************/
+static size_t plasma_graph_hash(int desc, size_t offset)
+{
+    // FNV-1a
+    size_t hash = 2166136261u;
+    hash = (hash ^ (unsigned)desc) * 16777619u;
+    for (int i = 0; i < (int)sizeof(offset); i++)
+        hash = (hash ^ ((offset >> 8*i) & 0xff)) * 16777619u;
+    return hash;
+}
+
+/******************************************************************************/
+// Returns the slot of the tile in the table, or the empty slot for it.
+static plasma_graph_tile_t *plasma_graph_slot(plasma_graph_tile_t *tiles,
+                                              int size,
+                                              int desc, size_t offset)
+{
+    size_t mask = size-1;
+    size_t i = plasma_graph_hash(desc, offset) & mask;
+    while (tiles[i].used &&
+           (tiles[i].desc != desc || tiles[i].offset != offset))
+        i = (i+1) & mask;
+    return &tiles[i];
+}
+
+/******************************************************************************/
+// Doubles the table of tiles, keeping it at most half full.
+static int plasma_graph_grow_tiles(plasma_graph_t *graph)
+{
+    int size = graph->size == 0 ? 256 : 2*graph->size;
+    plasma_graph_tile_t *tiles =
+        (plasma_graph_tile_t*)calloc(size, sizeof(plasma_graph_tile_t));
+    if (tiles == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    for (int i = 0; i < graph->size; i++) {
+        plasma_graph_tile_t *tile = &graph->tiles[i];
+        if (tile->used)
+            *plasma_graph_slot(tiles, size, tile->desc, tile->offset) = *tile;
+    }
+    free(graph->tiles);
+    graph->tiles = tiles;
+    graph->size = size;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Adds the dependency of task succ on task pred, unless already added.
+// The dependencies of a task are added together, after those of
+// earlier tasks.
+static void plasma_graph_add_edge(plasma_graph_t *graph, int pred, int succ)
+{
+    int *edges = graph->edges;
+    for (int e = graph->num_edges-1; e >= 0 && edges[2*e+1] == succ; e--)
+        if (edges[2*e] == pred)
+            return;
+
+    if (graph->num_edges == graph->max_edges) {
+        int max_edges = graph->max_edges == 0 ? 1024 : 2*graph->max_edges;
+        edges = (int*)realloc(edges, 2*(size_t)max_edges*sizeof(int));
+        if (edges == NULL) {
+            graph->failed = 1;
+            return;
+        }
+        graph->edges = edges;
+        graph->max_edges = max_edges;
+    }
+    edges[2*graph->num_edges] = pred;
+    edges[2*graph->num_edges+1] = succ;
+    graph->num_edges++;
+}
+
+/******************************************************************************/
+// Frees the recording state of a graph.
+static void plasma_graph_free_recording(plasma_graph_t *graph)
+{
+    for (int i = 0; i < graph->size; i++)
+        free(graph->tiles[i].readers);
+    free(graph->tiles);
+    graph->tiles = NULL;
+    graph->size = 0;
+    graph->count = 0;
+
+    free(graph->edges);
+    graph->edges = NULL;
+    graph->num_edges = 0;
+    graph->max_edges = 0;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_graph
+ *
+ *  Returns the graph recorded for a call of a routine on descriptors
+ *  of the same shape, and makes it the most recently used one.
+ *
+ * @param[in] routine
+ *          Name of the routine, e.g., "potrf".
+ *
+ * @param[in] uplo
+ *          uplo of the call, or any value if the routine has none.
+ *
+ * @param[in] descs
+ *          Descriptors of the call, in the order of recording.
+ *
+ * @param[in] num_descs
+ *          Number of descriptors.
+ *
+ * @retval graph or NULL if none is cached.
+ *
+ ******************************************************************************/
+plasma_graph_t *plasma_graph_find(const char *routine, plasma_enum_t uplo,
+                                  const plasma_desc_t *descs, int num_descs)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL)
+        return NULL;
+
+    plasma_graph_t **link = &plasma->graphs;
+    for (plasma_graph_t *graph = *link; graph != NULL; graph = *link) {
+        int match = graph->uplo == uplo &&
+                    graph->lookahead == plasma->lookahead &&
+                    graph->num_descs == num_descs &&
+                    strcmp(graph->routine, routine) == 0;
+        for (int d = 0; match && d < num_descs; d++)
+            match = plasma_graph_desc_match(&graph->descs[d], &descs[d]);
+
+        if (match) {
+            *link = graph->next;
+            graph->next = plasma->graphs;
+            plasma->graphs = graph;
+            return graph;
+        }
+        link = &graph->next;
+    }
+    return NULL;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_graph
+ *
+ *  Creates an empty graph for recording a call of a routine.
+ *  The tasks are recorded by calling the tile async function of the
+ *  routine with sequence->graph set to the graph, which makes the
+ *  core_omp_*() functions add their tasks to it instead of creating them.
+ *
+ * @param[in] routine
+ *          Name of the routine, e.g., "potrf". Not copied.
+ *
+ * @param[in] uplo
+ *          uplo of the call.
+ *
+ * @param[in] descs
+ *          Descriptors of the call. Every tile of a recorded task has to
+ *          be in one of them.
+ *
+ * @param[in] num_descs
+ *          Number of descriptors, at most PLASMA_GRAPH_MAX_DESCS.
+ *
+ * @param[out] graph
+ *          The created graph.
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_graph_create(const char *routine, plasma_enum_t uplo,
+                        const plasma_desc_t *descs, int num_descs,
+                        plasma_graph_t **graph)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (num_descs < 1 || num_descs > PLASMA_GRAPH_MAX_DESCS) {
+        plasma_error("illegal number of descriptors");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_graph_t *g = (plasma_graph_t*)calloc(1, sizeof(plasma_graph_t));
+    if (g == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    g->routine = routine;
+    g->uplo = uplo;
+    g->lookahead = plasma->lookahead;
+    g->num_descs = num_descs;
+    for (int d = 0; d < num_descs; d++)
+        g->descs[d] = descs[d];
+
+    *graph = g;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_graph
+ *
+ *  Records a task, with the dependencies an OpenMP task with the same
+ *  depend clauses would have on the tasks recorded before it.
+ *  Marks the graph as failed if a tile is in none of its descriptors.
+ *
+ * @param[in,out] graph
+ *          The graph being recorded.
+ *
+ * @param[in] node
+ *          The task, with the addresses of its tiles.
+ *
+ ******************************************************************************/
+void plasma_graph_add(plasma_graph_t *graph, const plasma_graph_node_t *node)
+{
+    if (graph->failed)
+        return;
+
+    if (graph->num_nodes == graph->max_nodes) {
+        int max_nodes = graph->max_nodes == 0 ? 256 : 2*graph->max_nodes;
+        plasma_graph_node_t *nodes = (plasma_graph_node_t*)realloc(
+            graph->nodes, (size_t)max_nodes*sizeof(plasma_graph_node_t));
+        if (nodes == NULL) {
+            graph->failed = 1;
+            return;
+        }
+        graph->nodes = nodes;
+        graph->max_nodes = max_nodes;
+    }
+    int id = graph->num_nodes;
+    plasma_graph_node_t *task = &graph->nodes[id];
+    *task = *node;
+    task->num_pred = 0;
+    task->succ = 0;
+    task->num_succ = 0;
+
+    for (int t = 0; t < 3; t++) {
+        if (task->access[t] == PlasmaGraphNone)
+            continue;
+
+        // Find the descriptor holding the tile.
+        char *addr = (char*)task->tile[t];
+        int d;
+        for (d = 0; d < graph->num_descs; d++) {
+            char *matrix = (char*)graph->descs[d].matrix;
+            if (addr >= matrix &&
+                addr < matrix + plasma_graph_desc_extent(&graph->descs[d]))
+                break;
+        }
+        if (d == graph->num_descs) {
+            graph->failed = 1;
+            return;
+        }
+        task->desc[t] = d;
+        task->offset[t] = addr - (char*)graph->descs[d].matrix;
+        task->tile[t] = NULL;
+
+        if (2*(graph->count+1) > graph->size &&
+            plasma_graph_grow_tiles(graph) != PlasmaSuccess) {
+            graph->failed = 1;
+            return;
+        }
+        plasma_graph_tile_t *tile = plasma_graph_slot(
+            graph->tiles, graph->size, d, task->offset[t]);
+        if (! tile->used) {
+            tile->used = 1;
+            tile->desc = d;
+            tile->offset = task->offset[t];
+            tile->writer = -1;
+            graph->count++;
+        }
+
+        // Reads follow the last write, and writes follow the reads since.
+        if (tile->writer >= 0 && tile->writer != id)
+            plasma_graph_add_edge(graph, tile->writer, id);
+
+        if (task->access[t] == PlasmaGraphIn) {
+            if (tile->num_readers == tile->max_readers) {
+                int max_readers =
+                    tile->max_readers == 0 ? 8 : 2*tile->max_readers;
+                int *readers = (int*)realloc(
+                    tile->readers, (size_t)max_readers*sizeof(int));
+                if (readers == NULL) {
+                    graph->failed = 1;
+                    return;
+                }
+                tile->readers = readers;
+                tile->max_readers = max_readers;
+            }
+            tile->readers[tile->num_readers++] = id;
+        }
+        else {
+            for (int r = 0; r < tile->num_readers; r++)
+                if (tile->readers[r] != id)
+                    plasma_graph_add_edge(graph, tile->readers[r], id);
+            tile->num_readers = 0;
+            tile->writer = id;
+        }
+    }
+    if (! graph->failed)
+        graph->num_nodes++;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_graph
+ *
+ *  Completes the recording of a graph and caches it in the context,
+ *  evicting the least recently used graph if the cache is full.
+ *  The successors of each task are sorted by decreasing priority,
+ *  which is the order the executor makes them ready in.
+ *
+ * @param[in,out] graph
+ *          The recorded graph. Destroyed if the recording failed.
+ *
+ * @retval graph or NULL if the recording failed.
+ *
+ ******************************************************************************/
+plasma_graph_t *plasma_graph_finalize(plasma_graph_t *graph)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL || graph->failed) {
+        plasma_graph_destroy(graph);
+        return NULL;
+    }
+    graph->succ = (int*)malloc((size_t)imax(1, graph->num_edges)*sizeof(int));
+    if (graph->succ == NULL) {
+        plasma_graph_destroy(graph);
+        return NULL;
+    }
+
+    // Count, then place the successors of each task.
+    plasma_graph_node_t *nodes = graph->nodes;
+    for (int e = 0; e < graph->num_edges; e++) {
+        nodes[graph->edges[2*e]].num_succ++;
+        nodes[graph->edges[2*e+1]].num_pred++;
+    }
+    int first = 0;
+    for (int i = 0; i < graph->num_nodes; i++) {
+        nodes[i].succ = first;
+        first += nodes[i].num_succ;
+        nodes[i].num_succ = 0;
+    }
+    for (int e = 0; e < graph->num_edges; e++) {
+        plasma_graph_node_t *pred = &nodes[graph->edges[2*e]];
+        int succ = graph->edges[2*e+1];
+
+        // Insert by decreasing priority, keeping the order of creation.
+        int *list = &graph->succ[pred->succ];
+        int s = pred->num_succ++;
+        while (s > 0 && nodes[list[s-1]].priority < nodes[succ].priority) {
+            list[s] = list[s-1];
+            s--;
+        }
+        list[s] = succ;
+    }
+    plasma_graph_free_recording(graph);
+
+    // Forget the addresses of the recorded descriptors.
+    for (int d = 0; d < graph->num_descs; d++) {
+        graph->descs[d].matrix = NULL;
+        graph->descs[d].inplace = NULL;
+        graph->descs[d].tiles = NULL;
+    }
+
+    graph->next = plasma->graphs;
+    plasma->graphs = graph;
+
+    // Evict the least recently used graph.
+    plasma_graph_t *last = graph;
+    for (int i = 1; i < PLASMA_GRAPH_CACHE_SIZE && last->next != NULL; i++)
+        last = last->next;
+    plasma_graph_cache_clear(&last->next);
+
+    return graph;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_graph
+ *
+ *  Destroys a graph.
+ *
+ ******************************************************************************/
+void plasma_graph_destroy(plasma_graph_t *graph)
+{
+    if (graph == NULL)
+        return;
+
+    plasma_graph_free_recording(graph);
+    free(graph->nodes);
+    free(graph->succ);
+    free(graph);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_graph
+ *
+ *  Destroys the graphs of a cache, e.g., plasma->graphs.
+ *
+ ******************************************************************************/
+void plasma_graph_cache_clear(plasma_graph_t **cache)
+{
+    plasma_graph_t *graph = *cache;
+    while (graph != NULL) {
+        plasma_graph_t *next = graph->next;
+        plasma_graph_destroy(graph);
+        graph = next;
+    }
+    *cache = NULL;
+}
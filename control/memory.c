@@ -0,0 +1,49 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#define _DEFAULT_SOURCE // posix_memalign(), madvise()
+
+#include "plasma_memory.h"
+#include "plasma_types.h"
+
+#include <stdlib.h>
+#include <sys/mman.h>
+
+// size of a transparent huge page
+static const size_t HugePageSize = 2*1024*1024;
+
+// size of a regular page
+static const size_t PageSize = 4096;
+
+/******************************************************************************/
+// Allocates memory to be released with free().
+// If huge_pages is PlasmaEnabled, buffers of at least a huge page are aligned
+// to and padded to whole huge pages, and backed by transparent huge pages
+// where the kernel supports them; smaller buffers are aligned to a page.
+// Falls back to malloc() if aligned memory is not available.
+void *plasma_memory_alloc(size_t size, int huge_pages)
+{
+    if (huge_pages == PlasmaEnabled) {
+        void *ptr = NULL;
+        if (size >= HugePageSize) {
+            size_t huge_size = (size+HugePageSize-1)/HugePageSize*HugePageSize;
+            if (posix_memalign(&ptr, HugePageSize, huge_size) == 0) {
+#ifdef MADV_HUGEPAGE
+                // Only advice; the kernel may still use regular pages.
+                madvise(ptr, huge_size, MADV_HUGEPAGE);
+#endif
+                return ptr;
+            }
+        }
+        else if (posix_memalign(&ptr, PageSize, size) == 0) {
+            return ptr;
+        }
+    }
+    return malloc(size);
+}
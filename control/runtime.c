@@ -0,0 +1,139 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_runtime.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <omp.h>
+
+/******************************************************************************/
+// Creates the tasks of queued jobs until the runtime is stopped.
+// Each job runs as a task, so that jobs overlap, and completes
+// once its taskgroup has.
+static void *plasma_runtime_main(void *arg)
+{
+    plasma_context_t *plasma = (plasma_context_t*)arg;
+    plasma_runtime_t *runtime = &plasma->runtime;
+
+    #pragma omp parallel num_threads(plasma->max_threads+1)
+    {
+        // Drivers and kernels find the context through the calling thread.
+        plasma_context_set_self(plasma);
+
+        #pragma omp master
+        {
+            for (;;) {
+                pthread_mutex_lock(&runtime->lock);
+                while (runtime->head == NULL && !runtime->stop)
+                    pthread_cond_wait(&runtime->queued, &runtime->lock);
+
+                plasma_job_t *job = runtime->head;
+                if (job != NULL) {
+                    runtime->head = job->next;
+                    if (runtime->head == NULL)
+                        runtime->tail = NULL;
+                }
+                pthread_mutex_unlock(&runtime->lock);
+
+                // Queued jobs are run before stopping.
+                if (job == NULL)
+                    break;
+
+                #pragma omp task firstprivate(job)
+                {
+                    plasma_sequence_t *sequence = job->sequence;
+
+                    #pragma omp taskgroup
+                    job->run(job);
+
+                    job->finish(job);
+
+                    pthread_mutex_lock(&runtime->lock);
+                    sequence->pending--;
+                    pthread_cond_broadcast(&runtime->done);
+                    pthread_mutex_unlock(&runtime->lock);
+                }
+            }
+        }
+        // Run the remaining tasks before unbinding the context.
+        #pragma omp barrier
+        plasma_context_set_self(NULL);
+    }
+    return NULL;
+}
+
+/******************************************************************************/
+void plasma_runtime_init(plasma_runtime_t *runtime)
+{
+    runtime->started = 0;
+    runtime->stop = 0;
+    runtime->head = NULL;
+    runtime->tail = NULL;
+    pthread_mutex_init(&runtime->lock, NULL);
+    pthread_cond_init(&runtime->queued, NULL);
+    pthread_cond_init(&runtime->done, NULL);
+}
+
+/******************************************************************************/
+void plasma_runtime_finalize(plasma_runtime_t *runtime)
+{
+    if (runtime->started) {
+        pthread_mutex_lock(&runtime->lock);
+        runtime->stop = 1;
+        pthread_cond_signal(&runtime->queued);
+        pthread_mutex_unlock(&runtime->lock);
+
+        pthread_join(runtime->thread, NULL);
+        runtime->started = 0;
+    }
+    pthread_mutex_destroy(&runtime->lock);
+    pthread_cond_destroy(&runtime->queued);
+    pthread_cond_destroy(&runtime->done);
+}
+
+/******************************************************************************/
+int plasma_runtime_submit(plasma_job_t *job)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    plasma_runtime_t *runtime = &plasma->runtime;
+
+    // Copy the tuning the caller has just set for this call.
+    job->ib = plasma->ib;
+    job->max_panel_threads = plasma->max_panel_threads;
+    job->lookahead = plasma->lookahead;
+
+    pthread_mutex_lock(&runtime->lock);
+    if (!runtime->started) {
+        if (pthread_create(&runtime->thread, NULL,
+                           plasma_runtime_main, plasma) != 0) {
+            pthread_mutex_unlock(&runtime->lock);
+            plasma_error("pthread_create() failed");
+            return PlasmaErrorInternal;
+        }
+        runtime->started = 1;
+    }
+    job->next = NULL;
+    if (runtime->tail != NULL)
+        runtime->tail->next = job;
+    else
+        runtime->head = job;
+    runtime->tail = job;
+
+    job->sequence->pending++;
+    pthread_cond_signal(&runtime->queued);
+    pthread_mutex_unlock(&runtime->lock);
+
+    return PlasmaSuccess;
+}
@@ -0,0 +1,227 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_stats.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <omp.h>
+
+// number of contexts with PlasmaStats enabled
+int plasma_stats_enabled = 0;
+
+// time the thread waited at barriers since its last task was counted
+static __thread double stats_barrier_time = 0.0;
+
+/******************************************************************************/
+// Returns the counters of a kernel in a table, adding them if not there.
+// Returns NULL if the table is full.
+static plasma_kernel_stats_t *plasma_stats_kernel(
+    plasma_kernel_stats_t *kernels, int *num_kernels, const char *name)
+{
+    // Names are mostly __func__, so compare the pointers first.
+    for (int i = 0; i < *num_kernels; i++)
+        if (kernels[i].name == name)
+            return &kernels[i];
+    for (int i = 0; i < *num_kernels; i++)
+        if (strcmp(kernels[i].name, name) == 0)
+            return &kernels[i];
+
+    if (*num_kernels == PLASMA_STATS_MAX_KERNELS)
+        return NULL;
+    plasma_kernel_stats_t *kernel = &kernels[(*num_kernels)++];
+    kernel->name = name;
+    kernel->num_tasks = 0;
+    kernel->time = 0.0;
+    kernel->flops = 0.0;
+    return kernel;
+}
+
+/******************************************************************************/
+// Returns the flops of fmas multiply-adds in the precision of the kernel,
+// given by the letter after core_ or core_omp_.
+static double plasma_stats_flops(const char *name, double fmas)
+{
+    if (strncmp(name, "core_", 5) == 0)
+        name += 5;
+    if (strncmp(name, "omp_", 4) == 0)
+        name += 4;
+    // A complex multiply-add takes 6 multiplies and 2 adds.
+    return (*name == 'z' || *name == 'c') ? 8.0*fmas : 2.0*fmas;
+}
+
+/******************************************************************************/
+int plasma_stats_sequence_create(int num_threads,
+                                 plasma_stats_sequence_t **stats)
+{
+    num_threads = imin(imax(1, num_threads), PLASMA_STATS_MAX_THREADS);
+
+    *stats = (plasma_stats_sequence_t*)malloc(sizeof(plasma_stats_sequence_t));
+    if (*stats == NULL) {
+        plasma_error("malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    (*stats)->threads = (plasma_stats_thread_t*)calloc(
+        num_threads, sizeof(plasma_stats_thread_t));
+    if ((*stats)->threads == NULL) {
+        plasma_error("calloc() failed");
+        free(*stats);
+        *stats = NULL;
+        return PlasmaErrorOutOfMemory;
+    }
+    (*stats)->num_threads = num_threads;
+    (*stats)->start = omp_get_wtime();
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+// Adds the counters of a sequence to the total, and frees them.
+void plasma_stats_sequence_destroy(plasma_stats_sequence_t *stats,
+                                   plasma_stats_t *total)
+{
+    if (stats == NULL)
+        return;
+
+    if (total != NULL) {
+        double time = omp_get_wtime()-stats->start;
+        total->num_sequences++;
+        total->time += time;
+
+        // Count the threads of the team that ran the tasks, which may
+        // have fewer threads than slots.
+        int num_threads = 0;
+        for (int t = 0; t < stats->num_threads; t++)
+            num_threads = imax(num_threads, stats->threads[t].team_size);
+        num_threads = imin(num_threads, stats->num_threads);
+        total->num_threads = imax(total->num_threads, num_threads);
+
+        for (int t = 0; t < num_threads; t++) {
+            plasma_stats_thread_t *thread = &stats->threads[t];
+            if (time > thread->busy_time)
+                total->idle_time[t] += time-thread->busy_time;
+            total->translation_time += thread->translation_time;
+            total->barrier_time += thread->barrier_time;
+
+            for (int i = 0; i < thread->num_kernels; i++) {
+                plasma_kernel_stats_t *src = &thread->kernels[i];
+                plasma_kernel_stats_t *dst = plasma_stats_kernel(
+                    total->kernels, &total->num_kernels, src->name);
+                if (dst != NULL) {
+                    dst->num_tasks += src->num_tasks;
+                    dst->time += src->time;
+                    dst->flops += src->flops;
+                }
+                total->flops += src->flops;
+            }
+        }
+    }
+    free(stats->threads);
+    free(stats);
+}
+
+/******************************************************************************/
+// Counts a task run by the calling thread.
+void plasma_stats_task(plasma_stats_sequence_t *stats, const char *name,
+                       double fmas, double start, double stop)
+{
+    int t = omp_get_thread_num();
+    if (t >= stats->num_threads)
+        return;
+
+    plasma_stats_thread_t *thread = &stats->threads[t];
+    thread->team_size = omp_get_num_threads();
+    thread->busy_time += stop-start;
+    thread->barrier_time += stats_barrier_time;
+    stats_barrier_time = 0.0;
+
+    plasma_kernel_stats_t *kernel =
+        plasma_stats_kernel(thread->kernels, &thread->num_kernels, name);
+    if (kernel != NULL) {
+        kernel->num_tasks++;
+        kernel->time += stop-start;
+        kernel->flops += plasma_stats_flops(name, fmas);
+    }
+}
+
+/******************************************************************************/
+// Counts time of a task of the calling thread translating between layouts,
+// which is also counted by plasma_stats_task().
+void plasma_stats_translation(plasma_stats_sequence_t *stats, double time)
+{
+    int t = omp_get_thread_num();
+    if (t >= stats->num_threads)
+        return;
+
+    stats->threads[t].translation_time += time;
+}
+
+/******************************************************************************/
+// Counts time waited at a barrier by the calling thread, which is added to
+// the sequence of the next task it completes.
+void plasma_stats_barrier(double time)
+{
+    stats_barrier_time += time;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_stats
+ *
+ *  Returns the statistics of the sequences destroyed since the last
+ *  plasma_reset_stats(), counted while PlasmaStats was enabled.
+ *
+ *******************************************************************************
+ *
+ * @param[out] stats
+ *          On exit, the statistics of the context of the calling thread.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_get_stats(plasma_stats_t *stats)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (stats == NULL) {
+        plasma_error("NULL stats");
+        return PlasmaErrorNullParameter;
+    }
+    *stats = plasma->stats_total;
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_stats
+ *
+ *  Clears the statistics of the context of the calling thread.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_reset_stats()
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    memset(&plasma->stats_total, 0, sizeof(plasma_stats_t));
+    return PlasmaSuccess;
+}
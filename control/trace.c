@@ -0,0 +1,388 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_trace.h"
+#include "plasma_internal.h"
+#include "plasma_stats.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// set while tracing, which needs -DPLASMA_TRACE
+int plasma_trace_enabled = 0;
+
+#ifdef PLASMA_TRACE
+
+// most events kept per thread, after which the oldest are overwritten
+static const int MaxEvents = 1 << 18;
+
+#define IMAGE_WIDTH 2390
+#define IMAGE_HEIGHT 1000
+
+/******************************************************************************/
+typedef struct {
+    const char *name; ///< name of the core_omp_*() function
+    const void *tile; ///< tile written, or read if none is
+    double start;     ///< omp_get_wtime() at the start of the task
+    double stop;      ///< omp_get_wtime() at the end of the task
+    int sequence;     ///< id of the sequence, -1 if none
+    int num_deps;     ///< number of dependencies recorded
+    plasma_trace_dep_t deps[PLASMA_TRACE_MAX_DEPS]; ///< dependencies
+} plasma_trace_event_t;
+
+static const char *Access[] = { "none", "in", "inout" };
+
+// Events of a thread, in a buffer doubled up to MaxEvents, then reused
+// as a ring.
+typedef struct plasma_trace_buffer_s {
+    plasma_trace_event_t *events;       ///< buffer of events
+    int size;                           ///< allocated number of events
+    long long num_events;               ///< events recorded, including lost
+    int thread;                         ///< number of the thread in the trace
+    struct plasma_trace_buffer_s *next; ///< buffer of another thread
+} plasma_trace_buffer_t;
+
+static __thread plasma_trace_buffer_t *trace_self = NULL;
+static plasma_trace_buffer_t *trace_buffers = NULL;
+static int trace_num_threads = 0;
+static char trace_prefix[256];
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// X11 colors of kernels, picked by name
+static const int Colors[] = {
+    0x4682B4, 0xDAA520, 0x3CB371, 0xCD5C5C, 0x9370DB, 0xF4A460,
+    0x20B2AA, 0xDB7093, 0x6B8E23, 0x87CEEB, 0xD2691E, 0xBC8F8F,
+    0x7B68EE, 0xFFD700, 0x66CDAA, 0xFF7F50
+};
+
+/******************************************************************************/
+static int plasma_trace_color(const char *name)
+{
+    // FNV-1a
+    unsigned hash = 2166136261u;
+    for (const char *c = name; *c != '\0'; c++)
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+    return Colors[hash % (sizeof(Colors)/sizeof(Colors[0]))];
+}
+
+/******************************************************************************/
+// Returns the first event kept in a buffer, for iterating up to num_events.
+static long long plasma_trace_first(const plasma_trace_buffer_t *buffer)
+{
+    return buffer->num_events > buffer->size ?
+           buffer->num_events - buffer->size : 0;
+}
+
+/******************************************************************************/
+static void plasma_trace_write_json(const char *file_name, double min_time)
+{
+    FILE *file = fopen(file_name, "w");
+    if (file == NULL) {
+        plasma_error("cannot open the trace file");
+        return;
+    }
+    fprintf(file, "{\"traceEvents\": [\n");
+    const char *sep = "";
+    for (plasma_trace_buffer_t *buffer = trace_buffers; buffer != NULL;
+         buffer = buffer->next) {
+        fprintf(file,
+                "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, "
+                "\"tid\": %d, \"args\": {\"name\": \"thread %d\"}}",
+                sep, buffer->thread, buffer->thread);
+        sep = ",\n";
+
+        for (long long e = plasma_trace_first(buffer);
+             e < buffer->num_events; e++) {
+            plasma_trace_event_t *event = &buffer->events[e % buffer->size];
+            // Times are in microseconds.
+            fprintf(file,
+                    ",\n{\"name\": \"%s\", \"cat\": \"kernel\", \"ph\": \"X\", "
+                    "\"pid\": 0, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, "
+                    "\"args\": {\"tile\": \"%p\", \"sequence\": %d, "
+                    "\"deps\": [",
+                    event->name, buffer->thread,
+                    1e6*(event->start-min_time),
+                    1e6*(event->stop-event->start),
+                    event->tile, event->sequence);
+            // Each dependency is [address, bytes, access].
+            for (int d = 0; d < event->num_deps; d++) {
+                plasma_trace_dep_t *dep = &event->deps[d];
+                fprintf(file, "%s[\"0x%llx\", %lld, \"%s\"]",
+                        d > 0 ? ", " : "",
+                        (unsigned long long)(uintptr_t)dep->begin,
+                        (long long)((const char*)dep->end -
+                                    (const char*)dep->begin),
+                        Access[dep->access]);
+            }
+            fprintf(file, "]}}");
+        }
+    }
+    fprintf(file, "\n],\n\"displayTimeUnit\": \"ms\"}\n");
+    fclose(file);
+    fprintf(stderr, "trace file: %s\n", file_name);
+}
+
+/******************************************************************************/
+static void plasma_trace_write_svg(const char *file_name,
+                                   double min_time, double max_time)
+{
+    FILE *file = fopen(file_name, "w");
+    if (file == NULL) {
+        plasma_error("cannot open the trace file");
+        return;
+    }
+    double total_time = max_time - min_time;
+    double hscale = IMAGE_WIDTH / total_time;
+    double vscale = IMAGE_HEIGHT / (trace_num_threads + 1);
+
+    fprintf(file, "<svg viewBox=\"0 0 %d %d\">\n", IMAGE_WIDTH, IMAGE_HEIGHT);
+
+    // events, with the legend made of the first event of each kernel
+    const char *names[64];
+    int num_names = 0;
+    for (plasma_trace_buffer_t *buffer = trace_buffers; buffer != NULL;
+         buffer = buffer->next) {
+        for (long long e = plasma_trace_first(buffer);
+             e < buffer->num_events; e++) {
+            plasma_trace_event_t *event = &buffer->events[e % buffer->size];
+            fprintf(file,
+                    "<rect x=\"%lf\" y=\"%lf\" width=\"%lf\" height=\"%lf\" "
+                    "fill=\"#%06x\" stroke=\"#000000\" stroke-width=\"0.2\" "
+                    "inkscape:label=\"%s\"/>\n",
+                    (event->start-min_time) * hscale,
+                    buffer->thread * vscale,
+                    (event->stop-event->start) * hscale,
+                    0.9 * vscale,
+                    plasma_trace_color(event->name),
+                    event->name);
+
+            int n = 0;
+            while (n < num_names && strcmp(names[n], event->name) != 0)
+                n++;
+            if (n == num_names && num_names < 64)
+                names[num_names++] = event->name;
+        }
+    }
+
+    // legend
+    int x = 0;
+    int y = IMAGE_HEIGHT+50;
+    for (int n = 0; n < num_names; n++) {
+        fprintf(file,
+                "<rect x=\"%d\" y=\"%d\" width=\"%d\" height=\"%d\" "
+                "fill=\"#%06x\" stroke=\"#000000\" stroke-width=\"1\"/>\n"
+                "<text x=\"%d\" y=\"%d\" "
+                "font-family=\"monospace\" font-size=\"35\" fill=\"black\">"
+                "%s</text>\n",
+                x, y, 50, 50, plasma_trace_color(names[n]),
+                x+75, y+36, names[n]);
+        x += 150 + (int)strlen(names[n])*22;
+        if (x > IMAGE_WIDTH) {
+            x = 0;
+            y += 100;
+        }
+    }
+
+    // time scale, with at most 20 ticks a power of 10 apart
+    double pwr = ceil(log10(total_time / 20));
+    double xtick = pow(10., pwr);
+    int decimal_places = (pwr < 0 ? (int)-pwr : 0);
+    for (double t = 0; t < total_time; t += xtick) {
+        fprintf(file,
+                "<line x1=\"%f\" x2=\"%f\" y1=\"%f\" y2=\"%f\" "
+                "stroke=\"#000000\" stroke-width=\"1\" />\n"
+                "<text x=\"%f\" y=\"%f\" "
+                "font-family=\"monospace\" font-size=\"35\">%.*f</text>\n",
+                hscale * t, hscale * t,
+                vscale * trace_num_threads,
+                vscale * (trace_num_threads + 0.9),
+                hscale * (t + 0.05*xtick),
+                vscale * (trace_num_threads + 0.9),
+                decimal_places, t);
+    }
+
+    fprintf(file, "</svg>\n");
+    fclose(file);
+    fprintf(stderr, "trace file: %s\n", file_name);
+}
+
+/******************************************************************************/
+// Writes the trace at exit, when the threads have stopped recording.
+static void plasma_trace_finish()
+{
+    double min_time = INFINITY;
+    double max_time = -INFINITY;
+    long long num_lost = 0;
+    for (plasma_trace_buffer_t *buffer = trace_buffers; buffer != NULL;
+         buffer = buffer->next) {
+        for (long long e = plasma_trace_first(buffer);
+             e < buffer->num_events; e++) {
+            plasma_trace_event_t *event = &buffer->events[e % buffer->size];
+            min_time = fmin(min_time, event->start);
+            max_time = fmax(max_time, event->stop);
+        }
+        num_lost += plasma_trace_first(buffer);
+    }
+
+    if (max_time > min_time) {
+        char file_name[sizeof(trace_prefix)+8];
+        snprintf(file_name, sizeof(file_name), "%s.json", trace_prefix);
+        plasma_trace_write_json(file_name, min_time);
+        snprintf(file_name, sizeof(file_name), "%s.svg", trace_prefix);
+        plasma_trace_write_svg(file_name, min_time, max_time);
+    }
+    if (num_lost > 0)
+        fprintf(stderr, "trace: %lld oldest events overwritten, "
+                        "%d kept per thread\n", num_lost, MaxEvents);
+
+    while (trace_buffers != NULL) {
+        plasma_trace_buffer_t *next = trace_buffers->next;
+        free(trace_buffers->events);
+        free(trace_buffers);
+        trace_buffers = next;
+    }
+}
+
+/******************************************************************************/
+// Returns the buffer of the calling thread, creating it on first use.
+static plasma_trace_buffer_t *plasma_trace_buffer()
+{
+    if (trace_self != NULL)
+        return trace_self;
+
+    plasma_trace_buffer_t *buffer =
+        (plasma_trace_buffer_t*)calloc(1, sizeof(plasma_trace_buffer_t));
+    if (buffer == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&trace_lock);
+    buffer->thread = trace_num_threads++;
+    buffer->next = trace_buffers;
+    trace_buffers = buffer;
+    pthread_mutex_unlock(&trace_lock);
+
+    trace_self = buffer;
+    return buffer;
+}
+
+/******************************************************************************/
+// Records an event in the buffer of the calling thread.
+static void plasma_trace_record(const char *name,
+                                double start, double stop,
+                                const plasma_sequence_t *sequence,
+                                const plasma_trace_dep_t *deps, int num_deps)
+{
+    plasma_trace_buffer_t *buffer = plasma_trace_buffer();
+    if (buffer == NULL)
+        return;
+
+    // Double the buffer until it holds MaxEvents.
+    if (buffer->num_events == buffer->size && buffer->size < MaxEvents) {
+        int size = buffer->size == 0 ? 1024 : 2*buffer->size;
+        plasma_trace_event_t *events = (plasma_trace_event_t*)realloc(
+            buffer->events, (size_t)size*sizeof(plasma_trace_event_t));
+        if (events != NULL) {
+            buffer->events = events;
+            buffer->size = size;
+        }
+    }
+    if (buffer->size == 0)
+        return;
+
+    plasma_trace_event_t *event =
+        &buffer->events[buffer->num_events % buffer->size];
+    event->name = name;
+    event->start = start;
+    event->stop = stop;
+    event->sequence = sequence != NULL ? sequence->id : -1;
+
+    // Name the task by the first memory it writes, else by the first.
+    event->tile = num_deps > 0 ? deps[0].begin : NULL;
+    for (int d = num_deps-1; d >= 0; d--)
+        if (deps[d].access == PlasmaGraphInout)
+            event->tile = deps[d].begin;
+
+    event->num_deps = imin(num_deps, PLASMA_TRACE_MAX_DEPS);
+    for (int d = 0; d < event->num_deps; d++)
+        event->deps[d] = deps[d];
+    buffer->num_events++;
+}
+
+#endif // PLASMA_TRACE
+
+/******************************************************************************/
+void plasma_trace_task(const char *name, double fmas,
+                       double start, double stop,
+                       const plasma_sequence_t *sequence,
+                       const plasma_trace_dep_t *deps, int num_deps)
+{
+#ifdef PLASMA_TRACE
+    if (plasma_trace_enabled)
+        plasma_trace_record(name, start, stop, sequence, deps, num_deps);
+#endif
+    if (sequence != NULL && sequence->stats != NULL)
+        plasma_stats_task(sequence->stats, name, fmas, start, stop);
+}
+
+/******************************************************************************/
+void plasma_trace_translation(const char *name,
+                              double start, double stop,
+                              const plasma_sequence_t *sequence,
+                              const plasma_trace_dep_t *deps, int num_deps)
+{
+    plasma_trace_task(name, 0.0, start, stop, sequence, deps, num_deps);
+    if (sequence != NULL && sequence->stats != NULL)
+        plasma_stats_translation(sequence->stats, stop-start);
+}
+
+/******************************************************************************/
+// Records a task by the tile it writes, with no extent.
+void plasma_trace_event(const char *name, const void *tile, double fmas,
+                        double start, double stop,
+                        const plasma_sequence_t *sequence)
+{
+    plasma_trace_dep_t dep = { tile, tile, PlasmaGraphInout };
+    plasma_trace_task(name, fmas, start, stop, sequence, &dep, 1);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_trace
+ *
+ *  Enables tracing if the environment variable PLASMA_TRACE is set and
+ *  not 0. The trace is written at exit to trace_<time>.json and .svg,
+ *  or to <value>.json and .svg if PLASMA_TRACE is not 1.
+ *  Does nothing unless compiled with -DPLASMA_TRACE.
+ *
+ ******************************************************************************/
+void plasma_trace_init()
+{
+#ifdef PLASMA_TRACE
+    pthread_mutex_lock(&trace_lock);
+    const char *value = getenv("PLASMA_TRACE");
+    if (! plasma_trace_enabled &&
+        value != NULL && *value != '\0' && strcmp(value, "0") != 0) {
+        if (strcmp(value, "1") == 0)
+            snprintf(trace_prefix, sizeof(trace_prefix), "trace_%ld",
+                     (long)time(NULL));
+        else
+            snprintf(trace_prefix, sizeof(trace_prefix), "%s", value);
+
+        atexit(plasma_trace_finish);
+        plasma_trace_enabled = 1;
+    }
+    pthread_mutex_unlock(&trace_lock);
+#endif
+}
@@ -15,8 +15,12 @@
 #include "plasma_types.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
+#include <omp.h>
+
 /******************************************************************************/
 lua_State *plasma_tuning_init()
 {
@@ -65,48 +69,219 @@ void plasma_tuning_finalize(lua_State *L)
 }
 
 /******************************************************************************/
-static void plasma_tune_int_int_int(lua_State *L, plasma_enum_t dtyp,
-                                    char *func_name, int x, int y, int *z)
+// Calls the tuning function <routine>_<param>(type, m, n, k, threads).
+// Returns the value of an integer parameter, or the PLASMA constant of
+// the Householder mode, which the function returns as "flat" or "tree".
+// Returns -1 if the tuning file does not define the function,
+// or if the function returns nil.
+static int plasma_tune_param(lua_State *L, const plasma_tuning_entry_t *entry,
+                             const char *param)
 {
-    int retval;
-    retval = lua_getglobal(L, func_name);
-    if (retval != LUA_TFUNCTION) {
-        plasma_error("lua_getglobal() failed");
-        return;
+    char func_name[64];
+    snprintf(func_name, sizeof(func_name), "%s_%s", entry->routine, param);
+
+    if (lua_getglobal(L, func_name) != LUA_TFUNCTION) {
+        lua_pop(L, 1);
+        return -1;
     }
-    switch (dtyp){
+    switch (entry->dtyp) {
         case PlasmaComplexDouble: lua_pushstring(L, "Z"); break;
         case PlasmaComplexFloat:  lua_pushstring(L, "C"); break;
         case PlasmaRealDouble:    lua_pushstring(L, "D"); break;
         case PlasmaRealFloat:     lua_pushstring(L, "S"); break;
-        default: plasma_error("invalid type"); return;
+        default:
+            lua_pop(L, 1);
+            plasma_error("invalid type");
+            return -1;
     }
-    lua_pushinteger(L, x);
-    lua_pushinteger(L, y);
+    lua_pushinteger(L, entry->m);
+    lua_pushinteger(L, entry->n);
+    lua_pushinteger(L, entry->k);
+    lua_pushinteger(L, entry->threads);
 
-    retval = lua_pcall(L, 3, 1, 0);
-    if (retval != LUA_OK) {
+    if (lua_pcall(L, 5, 1, 0) != LUA_OK) {
         plasma_error("lua_pcall() failed");
-        return;
+        lua_pop(L, 1);
+        return -1;
     }
-    retval = lua_tonumber(L, -1);
-    if (retval == 0) {
-        plasma_error("lua_tonumber() failed");
-        return;
+    int value = -1;
+    if (lua_isnil(L, -1)) {
+        // The function does not tune this case.
+    }
+    else if (strcmp(param, "householder_mode") == 0) {
+        const char *mode = lua_tostring(L, -1);
+        if (mode != NULL && strcmp(mode, "flat") == 0)
+            value = PlasmaFlatHouseholder;
+        else if (mode != NULL && strcmp(mode, "tree") == 0)
+            value = PlasmaTreeHouseholder;
+        else
+            plasma_error("invalid Householder mode in tuning file");
+    }
+    else {
+        int isnum;
+        value = (int)lua_tointegerx(L, -1, &isnum);
+        if (! isnum || value <= 0) {
+            plasma_error("invalid value in tuning file");
+            value = -1;
+        }
     }
-    *z = retval;
     lua_pop(L, 1);
+    return value;
+}
+
+/******************************************************************************/
+static size_t plasma_tuning_hash(const plasma_tuning_entry_t *entry)
+{
+    // FNV-1a
+    size_t hash = 2166136261u;
+    for (const char *c = entry->routine; *c != '\0'; c++)
+        hash = (hash ^ (unsigned char)*c) * 16777619u;
+    int key[] = { entry->dtyp, entry->m, entry->n, entry->k, entry->threads };
+    for (int i = 0; i < (int)(sizeof(key)/sizeof(key[0])); i++)
+        hash = (hash ^ (unsigned)key[i]) * 16777619u;
+    return hash;
+}
+
+/******************************************************************************/
+static int plasma_tuning_match(const plasma_tuning_entry_t *a,
+                               const plasma_tuning_entry_t *b)
+{
+    return a->dtyp == b->dtyp && a->m == b->m && a->n == b->n &&
+           a->k == b->k && a->threads == b->threads &&
+           strcmp(a->routine, b->routine) == 0;
+}
+
+/******************************************************************************/
+// Returns the slot of the entry in the cache, or the empty slot for it.
+static plasma_tuning_entry_t *plasma_tuning_cache_slot(
+    plasma_tuning_cache_t *cache, const plasma_tuning_entry_t *entry)
+{
+    size_t mask = cache->size-1;
+    size_t i = plasma_tuning_hash(entry) & mask;
+    while (cache->entries[i].routine != NULL &&
+           ! plasma_tuning_match(&cache->entries[i], entry))
+        i = (i+1) & mask;
+    return &cache->entries[i];
 }
 
 /******************************************************************************/
-void plasma_tune_getrf(plasma_context_t *plasma, plasma_enum_t dtyp,
-                       int m, int n)
+// Doubles the cache, keeping it at most half full.
+static int plasma_tuning_cache_grow(plasma_tuning_cache_t *cache)
+{
+    plasma_tuning_cache_t grown = *cache;
+    grown.size = cache->size == 0 ? 64 : 2*cache->size;
+    grown.entries = (plasma_tuning_entry_t*)calloc(
+        grown.size, sizeof(plasma_tuning_entry_t));
+    if (grown.entries == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    for (int i = 0; i < cache->size; i++)
+        if (cache->entries[i].routine != NULL)
+            *plasma_tuning_cache_slot(&grown, &cache->entries[i]) =
+                cache->entries[i];
+
+    free(cache->entries);
+    *cache = grown;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_tuning_cache_init(plasma_context_t *plasma)
+{
+    plasma_tuning_cache_t *cache = &plasma->tuning_cache;
+    cache->entries = NULL;
+    cache->size = 0;
+    cache->count = 0;
+    cache->set = 0;
+
+    // Parameters missing from the tuning file take the initial values.
+    cache->defaults.nb = plasma->nb;
+    cache->defaults.ib = plasma->ib;
+    cache->defaults.max_panel_threads = plasma->max_panel_threads;
+    cache->defaults.householder_mode = plasma->householder_mode;
+}
+
+/******************************************************************************/
+void plasma_tuning_cache_finalize(plasma_context_t *plasma)
+{
+    free(plasma->tuning_cache.entries);
+    plasma->tuning_cache.entries = NULL;
+    plasma->tuning_cache.size = 0;
+    plasma->tuning_cache.count = 0;
+}
+
+/******************************************************************************/
+// Marks a parameter as set by plasma_set(), so that tuning keeps it.
+void plasma_tuning_cache_set(plasma_context_t *plasma, plasma_enum_t param)
+{
+    plasma->tuning_cache.set |= 1 << param;
+}
+
+/***************************************************************************//**
+ *
+ *  Sets the tile size, inner block size, number of panel threads and
+ *  Householder mode for a call to routine, e.g., "getrf", with m-by-n
+ *  matrices and k right-hand sides (or inner dimension k, 0 if none).
+ *  Each parameter comes from the tuning file function <routine>_nb, etc.,
+ *  called as (type, m, n, k, threads). Parameters that the file does not
+ *  define take their initial values, and parameters set by plasma_set()
+ *  are left alone. The results are cached by routine, precision,
+ *  dimensions and number of threads, so that Lua is called only once
+ *  for each problem. The cache keeps routine, so it must be a literal.
+ *
+ ******************************************************************************/
+void plasma_tune(plasma_context_t *plasma, const char *routine,
+                 plasma_enum_t dtyp, int m, int n, int k)
 {
     if (plasma->L == NULL)
         return;
 
-    plasma_tune_int_int_int(plasma->L, dtyp, "getrf_nb", m, n, &plasma->nb);
-    plasma_tune_int_int_int(plasma->L, dtyp, "getrf_ib", m, n, &plasma->ib);
-    plasma_tune_int_int_int(plasma->L, dtyp, "getrf_max_panel_threads", m, n,
-                            &plasma->max_panel_threads);
+    plasma_tuning_cache_t *cache = &plasma->tuning_cache;
+    plasma_tuning_entry_t key;
+    key.routine = routine;
+    key.dtyp = dtyp;
+    key.m = m;
+    key.n = n;
+    key.k = k;
+    key.threads = omp_get_max_threads();
+
+    plasma_tuning_entry_t *entry = NULL;
+    if (cache->size > 0)
+        entry = plasma_tuning_cache_slot(cache, &key);
+
+    if (entry == NULL || entry->routine == NULL) {
+        key.params.nb = plasma_tune_param(plasma->L, &key, "nb");
+        key.params.ib = plasma_tune_param(plasma->L, &key, "ib");
+        key.params.max_panel_threads =
+            plasma_tune_param(plasma->L, &key, "max_panel_threads");
+        key.params.householder_mode =
+            plasma_tune_param(plasma->L, &key, "householder_mode");
+
+        // Without room in the cache, use the results uncached.
+        entry = &key;
+        if (2*(cache->count+1) <= cache->size ||
+            plasma_tuning_cache_grow(cache) == PlasmaSuccess) {
+            entry = plasma_tuning_cache_slot(cache, &key);
+            *entry = key;
+            cache->count++;
+        }
+    }
+
+    plasma_tuning_params_t params = entry->params;
+    plasma_tuning_params_t defaults = cache->defaults;
+    if (! (cache->set & (1 << PlasmaNb)))
+        plasma->nb = params.nb > 0 ? params.nb : defaults.nb;
+
+    if (! (cache->set & (1 << PlasmaIb)))
+        plasma->ib = params.ib > 0 ? params.ib : defaults.ib;
+
+    if (! (cache->set & (1 << PlasmaNumPanelThreads)))
+        plasma->max_panel_threads = params.max_panel_threads > 0 ?
+                                    params.max_panel_threads :
+                                    defaults.max_panel_threads;
+
+    if (! (cache->set & (1 << PlasmaHouseholderMode)))
+        plasma->householder_mode = params.householder_mode >= 0 ?
+                                   params.householder_mode :
+                                   defaults.householder_mode;
 }
@@ -9,6 +9,7 @@
  **/
 #include "plasma_workspace.h"
 #include "plasma_internal.h"
+#include "plasma_memory.h"
 
 #include <omp.h>
 
@@ -16,34 +17,48 @@
 int plasma_workspace_create(plasma_workspace_t *work, size_t lwork,
                             plasma_enum_t dtyp)
 {
-    // Allocate array of pointers.
-    #pragma omp parallel
-    #pragma omp master
-    {
-        work->nthread = omp_get_num_threads();
-    }
-    work->lwork = lwork;
-    work->dtyp  = dtyp;
-    if ((work->spaces = (void**)calloc(work->nthread, sizeof(void*))) == NULL) {
-        free(work->spaces);
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
+    work->spaces  = NULL;
+    work->busy    = NULL;
+    work->size    = 0;
+    work->lwork   = 0;
+    work->nthread = 0;
+    work->dtyp    = dtyp;
+    work->huge_pages = PlasmaDisabled;
+    return plasma_workspace_reserve(work, lwork, dtyp);
+}
+
+/******************************************************************************/
+int plasma_workspace_reserve(plasma_workspace_t *work, size_t lwork,
+                             plasma_enum_t dtyp)
+{
+    size_t size = (size_t)lwork * plasma_element_size(dtyp);
+    int nthread = omp_get_max_threads();
+
+    // Grow only if the workspaces are too small or too few.
+    if (work->spaces == NULL || size > work->size || nthread > work->nthread) {
+        if (work->size > size)
+            size = work->size;
+        if (work->nthread > nthread)
+            nthread = work->nthread;
 
-    // Each thread allocates its workspace.
-    size_t size = (size_t)lwork * plasma_element_size(work->dtyp);
-    int info = PlasmaSuccess;
-    #pragma omp parallel
-    {
-        int tid = omp_get_thread_num();
-        if ((work->spaces[tid] = (void*)malloc(size)) == NULL) {
-            info = PlasmaErrorOutOfMemory;
-        }
-    }
-    if (info != PlasmaSuccess) {
         plasma_workspace_destroy(work);
+
+        // Allocate arrays of pointers and flags.
+        // Workspaces are allocated by the first task using them,
+        // which places them close to the thread running the task.
+        work->spaces = (void**)calloc(nthread, sizeof(void*));
+        work->busy = (int*)calloc(nthread, sizeof(int));
+        if (work->spaces == NULL || work->busy == NULL) {
+            plasma_workspace_destroy(work);
+            plasma_error("calloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
+        work->size = size;
+        work->nthread = nthread;
     }
-    return info;
+    work->dtyp  = dtyp;
+    work->lwork = work->size / plasma_element_size(dtyp);
+    return PlasmaSuccess;
 }
 
 /******************************************************************************/
@@ -54,10 +69,50 @@ int plasma_workspace_destroy(plasma_workspace_t *work)
             free(work->spaces[i]);
             work->spaces[i] = NULL;
         }
-        free(work->spaces);
-        work->spaces  = NULL;
-        work->nthread = 0;
-        work->lwork   = 0;
     }
+    free(work->spaces);
+    free(work->busy);
+    work->spaces  = NULL;
+    work->busy    = NULL;
+    work->size    = 0;
+    work->nthread = 0;
+    work->lwork   = 0;
     return PlasmaSuccess;
 }
+
+/******************************************************************************/
+void *plasma_workspace_acquire(plasma_workspace_t work, int *slot)
+{
+    // Start with the slot of the calling thread, which is free
+    // unless tasks migrated or teams are nested.
+    if (work.nthread > 0) {
+        int first = omp_get_thread_num() % work.nthread;
+        for (int i = 0; i < work.nthread; i++) {
+            int s = (first+i) % work.nthread;
+            if (__sync_lock_test_and_set(&work.busy[s], 1) == 0) {
+                if (work.spaces[s] == NULL)
+                    work.spaces[s] = plasma_memory_alloc(work.size,
+                                                         work.huge_pages);
+
+                if (work.spaces[s] == NULL) {
+                    __sync_lock_release(&work.busy[s]);
+                    break;
+                }
+                *slot = s;
+                return work.spaces[s];
+            }
+        }
+    }
+    // Fall back to a private workspace.
+    *slot = -1;
+    return plasma_memory_alloc(work.size, work.huge_pages);
+}
+
+/******************************************************************************/
+void plasma_workspace_release(plasma_workspace_t work, int slot, void *space)
+{
+    if (slot < 0)
+        free(space);
+    else
+        __sync_lock_release(&work.busy[slot]);
+}
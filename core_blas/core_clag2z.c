@@ -13,6 +13,7 @@
 #include "core_blas.h"
 #include "core_lapack.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 
 /***************************************************************************//**
  *
@@ -61,7 +62,9 @@ void core_omp_clag2z(int m, int n,
     #pragma omp task depend(in:As[0:ldas*n]) \
                      depend(out:A[0:lda*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_clag2z(m, n, As, ldas, A, lda);
+        PLASMA_TRACE_STOP(As, sequence);
     }
 }
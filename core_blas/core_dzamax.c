@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -27,6 +28,7 @@ void core_omp_dzamax(int colrow, int m, int n,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:values[0:n])
         {
+            PLASMA_TRACE_START();
             if (sequence->status == PlasmaSuccess) {
                 for (int j = 0; j < n; j++) {
                     values[j] = core_dcabs1(A[lda*j]);
@@ -37,12 +39,14 @@ void core_omp_dzamax(int colrow, int m, int n,
                     }
                 }
             }
+            PLASMA_TRACE_STOP(A, sequence);
         }
         break;
     case PlasmaRowwise:
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:values[0:m])
         {
+            PLASMA_TRACE_START();
             if (sequence->status == PlasmaSuccess) {
                 for (int i = 0; i < m; i++)
                     values[i] = core_dcabs1(A[i]);
@@ -55,6 +59,7 @@ void core_omp_dzamax(int colrow, int m, int n,
                     }
                 }
             }
+            PLASMA_TRACE_STOP(A, sequence);
         }
         break;
     }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -178,10 +179,12 @@ void core_omp_zgelqt(int m, int n, int ib,
                      depend(out:T[0:ib*m]) // T should be mxib, but is stored
                                            // as ibxm
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *tau = (plasma_complex64_t*)work.spaces[tid];
+            int slot;
+            plasma_complex64_t *tau =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
 
             // Call the kernel.
             int info = core_zgelqt(m, n, ib,
@@ -190,10 +193,16 @@ void core_omp_zgelqt(int m, int n, int ib,
                                    tau,
                                    tau+m);
 
+            plasma_workspace_release(work, slot, tau);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_zgelqt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_EVENT(__func__, A,
+                           m >= n ? (double)m*n*n - (double)n*n*n/3
+                                  : (double)n*m*m - (double)m*m*m/3,
+                           sequence);
     }
 }
@@ -12,6 +12,9 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_dispatch.h"
+#include "plasma_graph.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -100,6 +103,49 @@ void core_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                 CBLAS_SADDR(beta),  C, ldc);
 }
 
+/******************************************************************************/
+// Arguments of a gemm task, kept until it runs, e.g., on the socket of C.
+typedef struct {
+    plasma_dispatch_task_t task;
+    plasma_enum_t transa;
+    plasma_enum_t transb;
+    int m;
+    int n;
+    int k;
+    plasma_complex64_t alpha;
+    const plasma_complex64_t *A;
+    int lda;
+    int ak;
+    const plasma_complex64_t *B;
+    int ldb;
+    int bk;
+    plasma_complex64_t beta;
+    plasma_complex64_t *C;
+    int ldc;
+    plasma_sequence_t *sequence;
+} core_omp_zgemm_args_t;
+
+static void core_omp_zgemm_run(void *arg)
+{
+    core_omp_zgemm_args_t *args = (core_omp_zgemm_args_t*)arg;
+    const plasma_complex64_t *A = args->A;
+    const plasma_complex64_t *B = args->B;
+    plasma_complex64_t *C = args->C;
+
+    PLASMA_TRACE_START();
+    if (args->sequence->status == PlasmaSuccess)
+        core_zgemm(args->transa, args->transb,
+                   args->m, args->n, args->k,
+                   args->alpha, A, args->lda,
+                                B, args->ldb,
+                   args->beta,  C, args->ldc);
+    PLASMA_TRACE_TASK("core_omp_zgemm",
+                      (double)args->m*args->n*args->k, args->sequence,
+                      {A, A+args->lda*args->ak, PlasmaGraphIn},
+                      {B, B+args->ldb*args->bk, PlasmaGraphIn},
+                      {C, C+args->ldc*args->n,  PlasmaGraphInout});
+}
+
 /******************************************************************************/
 void core_omp_zgemm(
     plasma_enum_t transa, plasma_enum_t transb,
@@ -107,8 +153,26 @@ void core_omp_zgemm(
     plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
                               const plasma_complex64_t *B, int ldb,
     plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    int priority,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    // Record the task instead of creating it, if recording.
+    if (sequence->graph != NULL) {
+        plasma_graph_node_t node = {
+            .kernel = PlasmaGraphGemm,
+            .priority = priority,
+            .param = { transa, transb },
+            .dim = { m, n, k },
+            .alpha = alpha,
+            .beta = beta,
+            .tile = { (void*)A, (void*)B, C },
+            .ld = { lda, ldb, ldc },
+            .access = { PlasmaGraphIn, PlasmaGraphIn, PlasmaGraphInout }
+        };
+        plasma_graph_add(sequence->graph, &node);
+        return;
+    }
+
     int ak;
     if (transa == PlasmaNoTrans)
         ak = k;
@@ -121,15 +185,21 @@ void core_omp_zgemm(
     else
         bk = k;
 
+    core_omp_zgemm_args_t args = {
+        .task = { .run = core_omp_zgemm_run, .priority = priority },
+        .transa = transa, .transb = transb,
+        .m = m, .n = n, .k = k,
+        .alpha = alpha, .A = A, .lda = lda, .ak = ak,
+                        .B = B, .ldb = ldb, .bk = bk,
+        .beta = beta,   .C = C, .ldc = ldc,
+        .sequence = sequence
+    };
+
+    // Run the task on the socket owning C, if PlasmaTaskAffinity is
+    // enabled and C was placed.
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
-    {
-        if (sequence->status == PlasmaSuccess)
-            core_zgemm(transa, transb,
-                       m, n, k,
-                       alpha, A, lda,
-                              B, ldb,
-                       beta,  C, ldc);
-    }
+                     depend(inout:C[0:ldc*n]) \
+                     priority(priority) firstprivate(args)
+    plasma_dispatch(sequence->dispatch, C, &args.task);
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -172,15 +173,19 @@ void core_omp_zgeqrt(int m, int n, int ib,
                      plasma_complex64_t *A, int lda,
                      plasma_complex64_t *T, int ldt,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(inout:A[0:lda*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(priority)
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
+            int slot;
+            plasma_complex64_t *tau =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
 
             // Call the kernel.
             int info = core_zgeqrt(m, n, ib,
@@ -189,10 +194,18 @@ void core_omp_zgeqrt(int m, int n, int ib,
                                    tau,
                                    tau+n);
 
+            plasma_workspace_release(work, slot, tau);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_zgeqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_TASK(__func__,
+                          m >= n ? (double)m*n*n - (double)n*n*n/3
+                                 : (double)n*m*m - (double)m*m*m/3,
+                          sequence,
+                          {A, A+lda*n, PlasmaGraphInout},
+                          {T, T+ib*n, PlasmaGraphInout});
     }
 }
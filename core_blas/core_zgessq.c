@@ -14,6 +14,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /******************************************************************************/
@@ -37,11 +38,13 @@ void core_omp_zgessq(int m, int n,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_zgessq(m, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
 
@@ -55,6 +58,7 @@ void core_omp_zgessq_aux(int n,
                      depend(in:sumsq[0:n]) \
                      depend(out:value[0:1])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             double scl = 0.0;
             double sum = 1.0;
@@ -69,5 +73,6 @@ void core_omp_zgessq_aux(int n,
             }
             *value = scl*sqrt(sum);
         }
+        PLASMA_TRACE_STOP(scale, sequence);
     }
 }
@@ -15,32 +15,44 @@
 #include "plasma_barrier.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_stats.h"
+#include "plasma_trace.h"
 #include "plasma_types.h"
 
 #include <omp.h>
 #include <assert.h>
 #include <math.h>
 
-static int *max_idx;
-static plasma_complex64_t *max_val;
-static volatile int info;
-
 #define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
 
 /******************************************************************************/
-int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                plasma_barrier_t *barrier)
+// Waits at the barrier, counting the wait in the statistics if enabled.
+static inline void core_zgetrf_barrier_wait(plasma_barrier_t *barrier,
+                                            int size)
 {
-    // Allocate arrays for parallel max search.
-    if (rank == 0) {
-        max_idx = (int*)malloc(size*sizeof(int));
-        max_val = (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
-        info = 0;
+    if (plasma_stats_enabled) {
+        double start = omp_get_wtime();
+        plasma_barrier_wait(barrier, size);
+        plasma_stats_barrier(omp_get_wtime()-start);
+    }
+    else {
+        plasma_barrier_wait(barrier, size);
     }
-    plasma_barrier_wait(barrier, size);
-    assert(max_idx != NULL);
-    assert(max_val != NULL);
+}
 
+/***************************************************************************//**
+ *
+ *  Factors a panel with size threads. Each thread calls it with its rank.
+ *  The scratch of the parallel pivot search, max_idx and max_val of size
+ *  elements, the status info, initialized to 0, and the barrier belong to
+ *  the caller and are shared by the threads of the panel only, so that
+ *  panels can be factored concurrently.
+ *
+ ******************************************************************************/
+int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
+                volatile int *max_idx, volatile plasma_complex64_t *max_val,
+                volatile int *info, plasma_barrier_t *barrier)
+{
     double sfmin = LAPACKE_dlamch_work('S');
 
     for (int k = 0; k < imin(A.m, A.n); k += ib) {
@@ -84,7 +96,7 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                 }
             }
 
-            plasma_barrier_wait(barrier, size);
+            core_zgetrf_barrier_wait(barrier, size);
             if (rank == 0)
             {
                 // max reduction
@@ -101,8 +113,8 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                 ipiv[j] = jp-k+1;
 
                 // singularity check
-                if (info == 0 && max_val[0] == 0.0) {
-                    info = j+1;
+                if (*info == 0 && max_val[0] == 0.0) {
+                    *info = j+1;
                 }
                 else {
                     // pivot swap
@@ -116,7 +128,7 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                     }
                 }
             }
-            plasma_barrier_wait(barrier, size);
+            core_zgetrf_barrier_wait(barrier, size);
 
             // column scaling and trailing update (all ranks)
             for (int l = rank; l < A.mt; l += size) {
@@ -124,7 +136,7 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                 int ldal = plasma_tile_mmain(A, l);
                 int mval = plasma_tile_mview(A, l);
 
-                if (info == 0) {
+                if (*info == 0) {
                     // column scaling
                     if (cabs(a0[j+j*lda0]) >= sfmin) {
                         if (l == 0) {
@@ -164,13 +176,13 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                                                     &al[+(j+1)*ldal], ldal);
                 }
             }
-            plasma_barrier_wait(barrier, size);
+            core_zgetrf_barrier_wait(barrier, size);
         }
 
         //===================================
         // right pivoting and trsm (rank 0)
         //===================================
-        plasma_barrier_wait(barrier, size);
+        core_zgetrf_barrier_wait(barrier, size);
         if (rank == 0) {
             // pivot adjustment
             for (int i = k+1; i <= imin(A.m, k+kb); i++)
@@ -195,7 +207,7 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                         CBLAS_SADDR(zone), &a0[k+k*lda0], lda0,
                                            &a0[k+(k+kb)*lda0], lda0);
         }
-        plasma_barrier_wait(barrier, size);
+        core_zgetrf_barrier_wait(barrier, size);
 
         //===================
         // gemm (all ranks)
@@ -228,7 +240,7 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                             CBLAS_SADDR(zone),  &ai[(k+kb)*ldai], ldai);
             }
         }
-        plasma_barrier_wait(barrier, size);
+        core_zgetrf_barrier_wait(barrier, size);
     }
 
     //============================
@@ -249,15 +261,9 @@ int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
         }
     }
 
-    // Free arrays for parallel max search.
-    if (rank == 0) {
-        free(max_idx);
-        free(max_val);
-    }
-
     // Only rank 0 returns errors.
     if (rank == 0)
-        return info;
+        return *info;
     else
         return 0;
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -89,10 +90,12 @@ void core_omp_zhegst(int itype, plasma_enum_t uplo,
     #pragma omp task depend(inout:A[0:lda*n]) \
                      depend(in:B[0:ldb*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zhegst(itype, uplo,
                         n,
                         A, lda,
                         B, ldb);
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
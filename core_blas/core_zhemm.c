@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -110,11 +111,15 @@ void core_omp_zhemm(
                      depend(in:B[0:ldb*n]) \
                      depend(inout:C[0:ldc*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zhemm(side, uplo,
                        m, n,
                        alpha, A, lda,
                               B, ldb,
                        beta,  C, ldc);
+        PLASMA_TRACE_EVENT(__func__, C,
+                           side == PlasmaLeft ? (double)m*m*n : (double)m*n*n,
+                           sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 #undef REAL
@@ -124,11 +125,13 @@ void core_omp_zher2k(
                      depend(in:B[0:ldb*bk]) \
                      depend(inout:C[0:ldc*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zher2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+        PLASMA_TRACE_EVENT(__func__, C, (double)k*n*n, sequence);
     }
 }
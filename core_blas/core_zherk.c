@@ -12,6 +12,9 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_dispatch.h"
+#include "plasma_graph.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -82,26 +85,86 @@ void core_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                 beta,  C, ldc);
 }
 
+/******************************************************************************/
+// Arguments of a herk task, kept until it runs, e.g., on the socket of C.
+typedef struct {
+    plasma_dispatch_task_t task;
+    plasma_enum_t uplo;
+    plasma_enum_t trans;
+    int n;
+    int k;
+    double alpha;
+    const plasma_complex64_t *A;
+    int lda;
+    int ak;
+    double beta;
+    plasma_complex64_t *C;
+    int ldc;
+    plasma_sequence_t *sequence;
+} core_omp_zherk_args_t;
+
+static void core_omp_zherk_run(void *arg)
+{
+    core_omp_zherk_args_t *args = (core_omp_zherk_args_t*)arg;
+    const plasma_complex64_t *A = args->A;
+    plasma_complex64_t *C = args->C;
+    int n = args->n;
+
+    PLASMA_TRACE_START();
+    if (args->sequence->status == PlasmaSuccess)
+        core_zherk(args->uplo, args->trans,
+                   n, args->k,
+                   args->alpha, A, args->lda,
+                   args->beta,  C, args->ldc);
+    PLASMA_TRACE_TASK("core_omp_zherk", 0.5*args->k*n*(n+1), args->sequence,
+                      {A, A+args->lda*args->ak, PlasmaGraphIn},
+                      {C, C+args->ldc*n, PlasmaGraphInout});
+}
+
 /******************************************************************************/
 void core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                     int n, int k,
                     double alpha, const plasma_complex64_t *A, int lda,
                     double beta,        plasma_complex64_t *C, int ldc,
+                    int priority,
                     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    // Record the task instead of creating it, if recording.
+    if (sequence->graph != NULL) {
+        plasma_graph_node_t node = {
+            .kernel = PlasmaGraphHerk,
+            .priority = priority,
+            .param = { uplo, trans },
+            .dim = { n, k },
+            .alpha = alpha,
+            .beta = beta,
+            .tile = { (void*)A, C },
+            .ld = { lda, ldc },
+            .access = { PlasmaGraphIn, PlasmaGraphInout }
+        };
+        plasma_graph_add(sequence->graph, &node);
+        return;
+    }
+
     int ak;
     if (trans == PlasmaNoTrans)
         ak = k;
     else
         ak = n;
 
+    core_omp_zherk_args_t args = {
+        .task = { .run = core_omp_zherk_run, .priority = priority },
+        .uplo = uplo, .trans = trans,
+        .n = n, .k = k,
+        .alpha = alpha, .A = A, .lda = lda, .ak = ak,
+        .beta = beta,   .C = C, .ldc = ldc,
+        .sequence = sequence
+    };
+
+    // Run the task on the socket owning C, if PlasmaTaskAffinity is
+    // enabled and C was placed.
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
-    {
-        if (sequence->status == PlasmaSuccess)
-            core_zherk(uplo, trans,
-                       n, k,
-                       alpha, A, lda,
-                       beta,  C, ldc);
-    }
+                     depend(inout:C[0:ldc*n]) \
+                     priority(priority) firstprivate(args)
+    plasma_dispatch(sequence->dispatch, C, &args.task);
 }
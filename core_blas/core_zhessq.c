@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -62,10 +63,12 @@ void core_omp_zhessq(plasma_enum_t uplo,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_zhessq(uplo, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -117,10 +118,38 @@ void core_omp_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:B[0:ldb*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zlacpy(uplo, transa,
                         m, n,
                         A, lda,
                         B, ldb);
+        PLASMA_TRACE_TASK(__func__, 0.0, sequence,
+                          {A, A+lda*n, PlasmaGraphIn},
+                          {B, B+ldb*n, PlasmaGraphInout});
+    }
+}
+
+/******************************************************************************/
+// Copies a tile between LAPACK and tile layouts as core_omp_zlacpy() does,
+// counting the task as translation in the statistics.
+void core_omp_zlacpy_translate(int m, int n,
+                               const plasma_complex64_t *A, int lda,
+                                     plasma_complex64_t *B, int ldb,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request)
+{
+    #pragma omp task depend(in:A[0:lda*n]) \
+                     depend(out:B[0:ldb*n])
+    {
+        PLASMA_TRACE_START();
+        if (sequence->status == PlasmaSuccess)
+            core_zlacpy(PlasmaGeneral, PlasmaNoTrans,
+                        m, n,
+                        A, lda,
+                        B, ldb);
+        PLASMA_TRACE_TRANSLATION(__func__, sequence,
+                                 {A, A+lda*n, PlasmaGraphIn},
+                                 {B, B+ldb*n, PlasmaGraphInout});
     }
 }
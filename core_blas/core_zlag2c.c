@@ -13,6 +13,7 @@
 #include "core_blas.h"
 #include "core_lapack.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 
 /***************************************************************************//**
  *
@@ -61,7 +62,9 @@ void core_omp_zlag2c(int m, int n,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:As[0:ldas*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zlag2c(m, n, A, lda, As, ldas);
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -69,8 +70,10 @@ void core_omp_zlange(int norm, int m, int n,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:value[0:1])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zlange(norm, m, n, A, lda, work, value);
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
 
@@ -85,6 +88,7 @@ void core_omp_zlange_aux(int norm, int m, int n,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:n])
         {
+            PLASMA_TRACE_START();
             if (sequence->status == PlasmaSuccess) {
                 for (int j = 0; j < n; j++) {
                     value[j] = cabs(A[lda*j]);
@@ -93,12 +97,14 @@ void core_omp_zlange_aux(int norm, int m, int n,
                     }
                 }
             }
+            PLASMA_TRACE_STOP(A, sequence);
         }
         break;
     case PlasmaInfNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:m])
         {
+            PLASMA_TRACE_START();
             if (sequence->status == PlasmaSuccess) {
                 for (int i = 0; i < m; i++)
                     value[i] = 0.0;
@@ -109,6 +115,7 @@ void core_omp_zlange_aux(int norm, int m, int n,
                     }
                 }
             }
+            PLASMA_TRACE_STOP(A, sequence);
         }
         break;
     }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -38,8 +39,10 @@ void core_omp_zlanhe(plasma_enum_t norm, plasma_enum_t uplo,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:value[0:1])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zlanhe(norm, uplo, n, A, lda, work, value);
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
 
@@ -56,6 +59,7 @@ void core_omp_zlanhe_aux(plasma_enum_t norm, plasma_enum_t uplo,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:n])
         {
+            PLASMA_TRACE_START();
             if (sequence->status == PlasmaSuccess) {
                 if (uplo == PlasmaUpper) {
                     for (int i = 0; i < n; i++)
@@ -82,6 +86,7 @@ void core_omp_zlanhe_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            PLASMA_TRACE_STOP(A, sequence);
         }
         break;
     }
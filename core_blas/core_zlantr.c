@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -46,8 +47,10 @@ void core_omp_zlantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_t diag,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:value[0:1])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zlantr(norm, uplo, diag, m, n, A, lda, work, value);
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
 
@@ -64,6 +67,7 @@ void core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:n])
         {
+            PLASMA_TRACE_START();
             if (sequence->status == PlasmaSuccess) {
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
@@ -115,12 +119,14 @@ void core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            PLASMA_TRACE_STOP(A, sequence);
         }
         break;
     case PlasmaInfNorm:
         #pragma omp task depend(in:A[0:lda*n]) \
                          depend(out:value[0:m])
         {
+            PLASMA_TRACE_START();
             if (sequence->status == PlasmaSuccess) {
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
@@ -181,6 +187,7 @@ void core_omp_zlantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                     }
                 }
             }
+            PLASMA_TRACE_STOP(A, sequence);
         }
         break;
     }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /******************************************************************************/
@@ -41,10 +42,12 @@ void core_omp_zlascl(plasma_enum_t uplo,
 {
     #pragma omp task depend(inout:A[0:lda*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zlascl(uplo,
                         cfrom, cto,
                         m, n,
                         A, lda);
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -77,7 +78,12 @@ void core_omp_zlaset(plasma_enum_t uplo,
                      plasma_complex64_t *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    core_zlaset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        PLASMA_TRACE_START();
+        core_zlaset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        PLASMA_TRACE_TASK(__func__, 0.0, NULL,
+                          {A, A+mb*nb, PlasmaGraphInout});
+    }
 }
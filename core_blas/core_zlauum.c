@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -70,6 +71,7 @@ void core_omp_zlauum(plasma_enum_t uplo,
 {
     #pragma omp task depend(inout:A[0:lda*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             int info = core_zlauum(uplo, n, A, lda);
             if (info != PlasmaSuccess) {
@@ -77,5 +79,6 @@ void core_omp_zlauum(plasma_enum_t uplo,
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
@@ -12,6 +12,8 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -66,10 +68,29 @@ void core_omp_zpotrf(plasma_enum_t uplo,
                      int n,
                      plasma_complex64_t *A, int lda,
                      int iinfo,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    // Record the task instead of creating it, if recording.
+    if (sequence->graph != NULL) {
+        plasma_graph_node_t node = {
+            .kernel = PlasmaGraphPotrf,
+            .priority = priority,
+            .param = { uplo },
+            .dim = { n },
+            .iinfo = iinfo,
+            .tile = { A },
+            .ld = { lda },
+            .access = { PlasmaGraphInout }
+        };
+        plasma_graph_add(sequence->graph, &node);
+        return;
+    }
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     priority(priority)
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             int info = core_zpotrf(uplo,
                                    n,
@@ -77,5 +98,7 @@ void core_omp_zpotrf(plasma_enum_t uplo,
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        PLASMA_TRACE_TASK(__func__, (double)n*n*n/6, sequence,
+                          {A, A+lda*n, PlasmaGraphInout});
     }
 }
@@ -12,6 +12,8 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -88,8 +90,26 @@ void core_omp_zsyrk(
     int n, int k,
     plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
     plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    int priority,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    // Record the task instead of creating it, if recording.
+    if (sequence->graph != NULL) {
+        plasma_graph_node_t node = {
+            .kernel = PlasmaGraphSyrk,
+            .priority = priority,
+            .param = { uplo, trans },
+            .dim = { n, k },
+            .alpha = alpha,
+            .beta = beta,
+            .tile = { (void*)A, C },
+            .ld = { lda, ldc },
+            .access = { PlasmaGraphIn, PlasmaGraphInout }
+        };
+        plasma_graph_add(sequence->graph, &node);
+        return;
+    }
+
     int ak;
     if (trans == PlasmaNoTrans)
         ak = k;
@@ -97,12 +117,17 @@ void core_omp_zsyrk(
         ak = n;
 
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(priority)
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_zsyrk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+        PLASMA_TRACE_TASK(__func__, 0.5*k*n*(n+1), sequence,
+                          {A, A+lda*ak, PlasmaGraphIn},
+                          {C, C+ldc*n, PlasmaGraphInout});
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 #include <math.h>
@@ -62,11 +63,13 @@ void core_omp_zsyssq(plasma_enum_t uplo,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_zsyssq(uplo, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
 
@@ -80,6 +83,7 @@ void core_omp_zsyssq_aux(int m, int n,
                      depend(in:sumsq[0:n]) \
                      depend(out:value[0:1])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             double scl = 0.0;
             double sum = 1.0;
@@ -110,5 +114,6 @@ void core_omp_zsyssq_aux(int m, int n,
             }
             *value = scl*sqrt(sum);
         }
+        PLASMA_TRACE_STOP(scale, sequence);
     }
 }
@@ -13,6 +13,7 @@
 #include "core_blas.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -194,6 +195,7 @@ void core_omp_ztradd(
     #pragma omp task depend(in:A[0:lda*k]) \
                      depend(inout:B[0:ldb*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             int retval = core_ztradd(uplo, transa,
                                      m, n,
@@ -204,5 +206,6 @@ void core_omp_ztradd(
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP(B, sequence);
     }
 }
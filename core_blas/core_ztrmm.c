@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -126,11 +127,15 @@ void core_omp_ztrmm(
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(inout:B[0:ldb*m])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess)
             core_ztrmm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+        PLASMA_TRACE_EVENT(__func__, B,
+                           side == PlasmaLeft ? 0.5*n*m*m : 0.5*m*n*n,
+                           sequence);
     }
 }
@@ -12,6 +12,9 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_dispatch.h"
+#include "plasma_graph.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -98,6 +101,47 @@ void core_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                     B, ldb);
 }
 
+/******************************************************************************/
+// Arguments of a trsm task, kept until it runs, e.g., on the socket of B.
+typedef struct {
+    plasma_dispatch_task_t task;
+    plasma_enum_t side;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    plasma_enum_t diag;
+    int m;
+    int n;
+    plasma_complex64_t alpha;
+    const plasma_complex64_t *A;
+    int lda;
+    int ak;
+    plasma_complex64_t *B;
+    int ldb;
+    plasma_sequence_t *sequence;
+} core_omp_ztrsm_args_t;
+
+static void core_omp_ztrsm_run(void *arg)
+{
+    core_omp_ztrsm_args_t *args = (core_omp_ztrsm_args_t*)arg;
+    const plasma_complex64_t *A = args->A;
+    plasma_complex64_t *B = args->B;
+    int m = args->m;
+    int n = args->n;
+
+    PLASMA_TRACE_START();
+    if (args->sequence->status == PlasmaSuccess)
+        core_ztrsm(args->side, args->uplo,
+                   args->transa, args->diag,
+                   m, n,
+                   args->alpha, A, args->lda,
+                                B, args->ldb);
+    PLASMA_TRACE_TASK("core_omp_ztrsm",
+                      args->side == PlasmaLeft ? 0.5*n*m*m : 0.5*m*n*n,
+                      args->sequence,
+                      {A, A+args->lda*args->ak, PlasmaGraphIn},
+                      {B, B+args->ldb*n, PlasmaGraphInout});
+}
+
 /******************************************************************************/
 void core_omp_ztrsm(
     plasma_enum_t side, plasma_enum_t uplo,
@@ -105,22 +149,44 @@ void core_omp_ztrsm(
     int m, int n,
     plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
                                     plasma_complex64_t *B, int ldb,
+    int priority,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    // Record the task instead of creating it, if recording.
+    if (sequence->graph != NULL) {
+        plasma_graph_node_t node = {
+            .kernel = PlasmaGraphTrsm,
+            .priority = priority,
+            .param = { side, uplo, transa, diag },
+            .dim = { m, n },
+            .alpha = alpha,
+            .tile = { (void*)A, B },
+            .ld = { lda, ldb },
+            .access = { PlasmaGraphIn, PlasmaGraphInout }
+        };
+        plasma_graph_add(sequence->graph, &node);
+        return;
+    }
+
     int ak;
     if (side == PlasmaLeft)
         ak = m;
     else
         ak = n;
 
+    core_omp_ztrsm_args_t args = {
+        .task = { .run = core_omp_ztrsm_run, .priority = priority },
+        .side = side, .uplo = uplo, .transa = transa, .diag = diag,
+        .m = m, .n = n,
+        .alpha = alpha, .A = A, .lda = lda, .ak = ak,
+                        .B = B, .ldb = ldb,
+        .sequence = sequence
+    };
+
+    // Run the task on the socket owning B, if PlasmaTaskAffinity is
+    // enabled and B was placed.
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:B[0:ldb*n])
-    {
-        if (sequence->status == PlasmaSuccess)
-            core_ztrsm(side, uplo,
-                       transa, diag,
-                       m, n,
-                       alpha, A, lda,
-                              B, ldb);
-    }
+                     depend(inout:B[0:ldb*n]) \
+                     priority(priority) firstprivate(args)
+    plasma_dispatch(sequence->dispatch, B, &args.task);
 }
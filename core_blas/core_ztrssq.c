@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -96,10 +97,12 @@ void core_omp_ztrssq(plasma_enum_t uplo, plasma_enum_t diag,
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             *scale = 0.0;
             *sumsq = 1.0;
             core_ztrssq(uplo, diag, m, n, A, lda, scale, sumsq);
         }
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -73,11 +74,13 @@ void core_omp_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
 {
     #pragma omp task depend(inout:A[0:lda*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             int info = core_ztrtri(uplo, diag,
                                    n, A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
         }
+        PLASMA_TRACE_STOP(A, sequence);
     }
 }
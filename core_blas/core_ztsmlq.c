@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -265,10 +266,12 @@ void core_omp_ztsmlq(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:V[0:ldv*n2]) \
                      depend(in:T[0:ib*k])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            int slot;
+            plasma_complex64_t *W =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
             int ldwork = side == PlasmaLeft ? ib : n1;  // TODO: double check
 
             // Call the kernel.
@@ -280,10 +283,13 @@ void core_omp_ztsmlq(plasma_enum_t side, plasma_enum_t trans,
                                    T,  ldt,
                                    W,  ldwork);
 
+            plasma_workspace_release(work, slot, W);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_ztsmlq() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_EVENT(__func__, A1, 2.0*m2*n2*k, sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -254,17 +255,21 @@ void core_omp_ztsmqr(plasma_enum_t side, plasma_enum_t trans,
                      const plasma_complex64_t *V,  int ldv,
                      const plasma_complex64_t *T,  int ldt,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(inout:A1[0:lda1*n1]) \
                      depend(inout:A2[0:lda2*n2]) \
                      depend(in:V[0:ldv*k]) \
-                     depend(in:T[0:ib*k])
+                     depend(in:T[0:ib*k]) \
+                     priority(priority)
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            int slot;
+            plasma_complex64_t *W =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
             int ldwork = side == PlasmaLeft ? ib : m1; // TODO: double check
 
             // Call the kernel.
@@ -276,10 +281,17 @@ void core_omp_ztsmqr(plasma_enum_t side, plasma_enum_t trans,
                                    T,  ldt,
                                    W,  ldwork);
 
+            plasma_workspace_release(work, slot, W);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_ztsmqr() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_TASK(__func__, 2.0*m2*n2*k, sequence,
+                          {A1, A1+lda1*n1, PlasmaGraphInout},
+                          {A2, A2+lda2*n2, PlasmaGraphInout},
+                          {V, V+ldv*k, PlasmaGraphIn},
+                          {T, T+ib*k, PlasmaGraphIn});
     }
 }
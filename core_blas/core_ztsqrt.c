@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -214,16 +215,20 @@ void core_omp_ztsqrt(int m, int n, int ib,
                      plasma_complex64_t *A2, int lda2,
                      plasma_complex64_t *T,  int ldt,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(inout:A1[0:lda1*n]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(priority)
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
+            int slot;
+            plasma_complex64_t *tau =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
 
             // Call the kernel.
             int info = core_ztsqrt(m, n, ib,
@@ -233,10 +238,16 @@ void core_omp_ztsqrt(int m, int n, int ib,
                                    tau,
                                    tau+n);
 
+            plasma_workspace_release(work, slot, tau);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_ztsqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_TASK(__func__, (double)m*n*n, sequence,
+                          {A1, A1+lda1*n, PlasmaGraphInout},
+                          {A2, A2+lda2*n, PlasmaGraphInout},
+                          {T, T+ib*n, PlasmaGraphInout});
     }
 }
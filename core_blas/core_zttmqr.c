@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -268,10 +269,12 @@ void core_omp_zttmqr(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:V[0:ldv*k]) \
                      depend(in:T[0:ib*k])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            int slot;
+            plasma_complex64_t *W =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
             int ldwork = side == PlasmaLeft ? ib : m1; // TODO: double check
 
             // Call the kernel.
@@ -283,10 +286,13 @@ void core_omp_zttmqr(plasma_enum_t side, plasma_enum_t trans,
                                    T,  ldt,
                                    W,  ldwork);
 
+            plasma_workspace_release(work, slot, W);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_zttmqr() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP(A1, sequence);
     }
 }
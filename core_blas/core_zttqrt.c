@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -246,10 +247,12 @@ void core_omp_zttqrt(int m, int n, int ib,
                      depend(inout:A2[0:lda2*n]) \
                      depend(out:T[0:ib*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
+            int slot;
+            plasma_complex64_t *tau =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
 
             // Call the kernel.
             int info = core_zttqrt(m, n, ib,
@@ -259,10 +262,13 @@ void core_omp_zttqrt(int m, int n, int ib,
                                    tau,
                                    tau+n);
 
+            plasma_workspace_release(work, slot, tau);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_zttqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_STOP(A1, sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -253,10 +254,12 @@ void core_omp_zunmlq(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:T[0:ib*k]) \
                      depend(inout:C[0:ldc*n])
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            int slot;
+            plasma_complex64_t *W =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
             int ldwork = side == PlasmaLeft ? n : m; // TODO: double check
 
             // Call the kernel.
@@ -267,10 +270,16 @@ void core_omp_zunmlq(plasma_enum_t side, plasma_enum_t trans,
                                    C, ldc,
                                    W, ldwork);
 
+            plasma_workspace_release(work, slot, W);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_zunmlq() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_EVENT(__func__, C,
+                           side == PlasmaLeft ? 2.0*m*n*k - (double)n*k*k
+                                              : 2.0*m*n*k - (double)m*k*k,
+                           sequence);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "core_blas.h"
 #include "plasma_types.h"
+#include "plasma_trace.h"
 #include "plasma_internal.h"
 #include "core_lapack.h"
 
@@ -238,16 +239,20 @@ void core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                      const plasma_complex64_t *T, int ldt,
                            plasma_complex64_t *C, int ldc,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(in:A[0:lda*k]) \
                      depend(in:T[0:ib*k]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(priority)
     {
+        PLASMA_TRACE_START();
         if (sequence->status == PlasmaSuccess) {
             // Prepare workspaces.
-            int tid = omp_get_thread_num();
-            plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
+            int slot;
+            plasma_complex64_t *W =
+                (plasma_complex64_t*)plasma_workspace_acquire(work, &slot);
             int ldwork = side == PlasmaLeft ? n : m; // TODO: double check
 
             // Call the kernel.
@@ -258,10 +263,19 @@ void core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                                    C, ldc,
                                    W, ldwork);
 
+            plasma_workspace_release(work, slot, W);
+
             if (info != PlasmaSuccess) {
                 plasma_error("core_zunmqr() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
         }
+        PLASMA_TRACE_TASK(__func__,
+                          side == PlasmaLeft ? 2.0*m*n*k - (double)n*k*k
+                                             : 2.0*m*n*k - (double)m*k*k,
+                          sequence,
+                          {A, A+lda*k, PlasmaGraphIn},
+                          {T, T+ib*k, PlasmaGraphIn},
+                          {C, C+ldc*n, PlasmaGraphInout});
     }
 }
@@ -58,7 +58,8 @@ void core_zgessq(int m, int n,
                  double *scale, double *sumsq);
 
 int core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
-                plasma_barrier_t *barrier);
+                volatile int *max_idx, volatile plasma_complex64_t *max_val,
+                volatile int *info, plasma_barrier_t *barrier);
 
 int core_zhegst(int itype, plasma_enum_t uplo,
                 int n,
@@ -320,12 +321,14 @@ void core_omp_zgemm(
     plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
                               const plasma_complex64_t *B, int ldb,
     plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    int priority,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_zgeqrt(int m, int n, int ib,
                      plasma_complex64_t *A, int lda,
                      plasma_complex64_t *T, int ldt,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_zgessq(int m, int n,
@@ -365,6 +368,7 @@ void core_omp_zherk(plasma_enum_t uplo, plasma_enum_t trans,
                     int n, int k,
                     double alpha, const plasma_complex64_t *A, int lda,
                     double beta,        plasma_complex64_t *C, int ldc,
+                    int priority,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_zhessq(plasma_enum_t uplo,
@@ -391,6 +395,12 @@ void core_omp_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
                            plasma_complex64_t *B, int ldb,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void core_omp_zlacpy_translate(int m, int n,
+                               const plasma_complex64_t *A, int lda,
+                                     plasma_complex64_t *B, int ldb,
+                               plasma_sequence_t *sequence,
+                               plasma_request_t *request);
+
 void core_omp_zlacpy_lapack2tile_band(plasma_enum_t uplo,
                                       int it, int jt,
                                       int m, int n, int nb, int kl, int ku,
@@ -478,6 +488,7 @@ void core_omp_zpotrf(plasma_enum_t uplo,
                      int n,
                      plasma_complex64_t *A, int lda,
                      int iinfo,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_zsymm(
@@ -501,6 +512,7 @@ void core_omp_zsyrk(
     int n, int k,
     plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
     plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    int priority,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_ztradd(
@@ -524,6 +536,7 @@ void core_omp_ztrsm(
     int m, int n,
     plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
                                     plasma_complex64_t *B, int ldb,
+    int priority,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_ztrssq(plasma_enum_t uplo, plasma_enum_t diag,
@@ -561,6 +574,7 @@ void core_omp_ztsmqr(plasma_enum_t side, plasma_enum_t trans,
                      const plasma_complex64_t *V, int ldv,
                      const plasma_complex64_t *T, int ldt,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_ztsqrt(int m, int n, int ib,
@@ -568,6 +582,7 @@ void core_omp_ztsqrt(int m, int n, int ib,
                      plasma_complex64_t *A2, int lda2,
                      plasma_complex64_t *T,  int ldt,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 void core_omp_zttlqt(int m, int n, int ib,
@@ -616,6 +631,7 @@ void core_omp_zunmqr(plasma_enum_t side, plasma_enum_t trans,
                      const plasma_complex64_t *T, int ldt,
                            plasma_complex64_t *C, int ldc,
                      plasma_workspace_t work,
+                     int priority,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
 #undef COMPLEX
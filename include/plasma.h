@@ -13,6 +13,7 @@
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
 #include "plasma_context.h"
+#include "plasma_stats.h"
 #include "plasma_workspace.h"
 
 #include "plasma_s.h"
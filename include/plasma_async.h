@@ -26,6 +26,12 @@ static const plasma_request_t PlasmaRequestInitializer = {PlasmaSuccess};
 typedef struct {
     plasma_enum_t status;      ///< error code
     plasma_request_t *request; ///< failed request
+    struct plasma_dispatch_s *dispatch; ///< owners of tiles, if
+                                        ///  PlasmaTaskAffinity is enabled
+    int pending;               ///< number of async calls not yet completed
+    struct plasma_graph_s *graph; ///< records the tasks instead, if not NULL
+    int id;                    ///< number of the sequence, e.g., in traces
+    struct plasma_stats_s *stats; ///< counters, if PlasmaStats is enabled
 } plasma_sequence_t;
 
 /******************************************************************************/
@@ -35,6 +41,9 @@ int plasma_request_fail(plasma_sequence_t *sequence,
 
 int plasma_sequence_create(plasma_sequence_t **sequence);
 int plasma_sequence_destroy(plasma_sequence_t *sequence);
+int plasma_sequence_wait(plasma_sequence_t *sequence);
+int plasma_sequence_test(plasma_sequence_t *sequence);
+int plasma_sequence_cancel(plasma_sequence_t *sequence);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -14,12 +14,37 @@
 extern "C" {
 #endif
 
-/******************************************************************************/
+// size of the cache line separating the fields of the barrier
+#define PLASMA_CACHE_LINE_SIZE 64
+
+/***************************************************************************//**
+ * @ingroup plasma_barrier
+ *
+ * Sense-reversing barrier. Threads arrive by incrementing count and wait
+ * for the last one to arrive, which resets count and reverses sense.
+ * The fields are in separate cache lines, so that waiting threads do not
+ * contend with arriving ones.
+ **/
 typedef struct {
-    int count;
-    volatile int passed;
+    volatile int count; ///< number of threads that arrived
+    char pad0[PLASMA_CACHE_LINE_SIZE-sizeof(int)];
+    volatile int sense; ///< reversed by the last thread to arrive
+    char pad1[PLASMA_CACHE_LINE_SIZE-sizeof(int)];
 } plasma_barrier_t;
 
+/******************************************************************************/
+// Tells the processor that the thread is spinning.
+static inline void plasma_barrier_pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#elif defined(__powerpc64__)
+    __asm__ __volatile__("or 27,27,27");
+#endif
+}
+
 /******************************************************************************/
 void plasma_barrier_init(plasma_barrier_t *barrier);
 void plasma_barrier_wait(plasma_barrier_t *barrier, int size);
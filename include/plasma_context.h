@@ -12,6 +12,12 @@
 
 #include "plasma_types.h"
 #include "plasma_barrier.h"
+#include "plasma_descriptor.h"
+#include "plasma_dispatch.h"
+#include "plasma_graph.h"
+#include "plasma_runtime.h"
+#include "plasma_stats.h"
+#include "plasma_workspace.h"
 
 #include <pthread.h>
 #include <lua.h>
@@ -22,6 +28,32 @@
 extern "C" {
 #endif
 
+/******************************************************************************/
+typedef struct {
+    int nb;                         ///< PlasmaNb
+    int ib;                         ///< PlasmaIb
+    int max_panel_threads;          ///< PlasmaNumPanelThreads
+    plasma_enum_t householder_mode; ///< PlasmaHouseholderMode
+} plasma_tuning_params_t;
+
+typedef struct {
+    const char *routine; ///< routine, e.g., "getrf"; NULL if the slot is empty
+    plasma_enum_t dtyp;  ///< precision
+    int m;               ///< number of rows
+    int n;               ///< number of columns
+    int k;               ///< number of right-hand sides or inner dimension
+    int threads;         ///< number of threads
+    plasma_tuning_params_t params; ///< -1 for parameters not in the file
+} plasma_tuning_entry_t;
+
+typedef struct {
+    plasma_tuning_entry_t *entries;  ///< open addressing hash table
+    int size;                        ///< number of slots, a power of two
+    int count;                       ///< number of used slots
+    int set;                         ///< bits of parameters set by plasma_set()
+    plasma_tuning_params_t defaults; ///< for parameters not in the file
+} plasma_tuning_cache_t;
+
 /******************************************************************************/
 typedef struct {
     lua_State *L;                   ///< Lua state
@@ -31,8 +63,21 @@ typedef struct {
     plasma_enum_t inplace_outplace; ///< PlasmaInplaceOutplace
     int max_threads;                ///< the value of OMP_NUM_THREADS
     int max_panel_threads;          ///< max threads for panel factorization
-    plasma_barrier_t barrier;       ///< thread barrier for multithreaded tasks
     plasma_enum_t householder_mode; ///< PlasmaHouseholderMode
+    plasma_pool_t pool;             ///< tile memory pool
+    plasma_enum_t placement;        ///< PlasmaTilePlacement
+    int num_sockets;                ///< PlasmaNumSockets
+    int affinity;                   ///< PlasmaTaskAffinity
+    plasma_dispatch_t dispatch;     ///< owners of tiles and socket queues
+    int tile_table;                 ///< PlasmaTileTable
+    int lookahead;                  ///< PlasmaLookahead
+    plasma_workspace_t work;        ///< per-thread scratch of core kernels
+    plasma_tuning_cache_t tuning_cache; ///< tuning file lookups by problem
+    plasma_runtime_t runtime;       ///< thread running plasma_*_async() calls
+    int task_graph;                 ///< PlasmaTaskGraph
+    plasma_graph_t *graphs;         ///< recorded calls, last used first
+    int stats;                      ///< PlasmaStats
+    plasma_stats_t stats_total;     ///< statistics of the sequences
 } plasma_context_t;
 
 typedef struct {
@@ -49,6 +94,7 @@ int plasma_get(plasma_enum_t param, int *value);
 int plasma_context_attach();
 int plasma_context_detach();
 plasma_context_t *plasma_context_self();
+void plasma_context_set_self(plasma_context_t *context);
 void plasma_context_init(plasma_context_t *context);
 void plasma_context_finalize(plasma_context_t *context);
 
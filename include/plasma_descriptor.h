@@ -11,8 +11,10 @@
 #define ICL_PLASMA_DESCRIPTOR_H
 
 #include "plasma_types.h"
+#include "plasma_async.h"
 #include "plasma_error.h"
 
+#include <pthread.h>
 #include <stdlib.h>
 #include <assert.h>
 
@@ -36,7 +38,19 @@ extern "C" {
  *     m2  |    A21   |A22|
  *         +----------+---+
  *
+ * A PlasmaGeneralLapack matrix is not stored by tiles, but by columns
+ * with leading dimension ld, as in LAPACK. Its tiles are addressed in place.
+ *
+ * If tiles is not NULL, it holds the address and leading dimension of each
+ * tile of the entire matrix, column by column with stride gmt, and points at
+ * the first tile of the submatrix. Views share the table of their matrix.
+ *
  **/
+typedef struct {
+    void *addr; ///< address of the tile
+    int ld;     ///< leading dimension of the tile
+} plasma_tile_t;
+
 typedef struct {
     // matrix properties
     plasma_enum_t type;      ///< general, general band, etc.
@@ -48,6 +62,9 @@ typedef struct {
     size_t A21;   ///< pointer to the beginning of A21
     size_t A12;   ///< pointer to the beginning of A12
     size_t A22;   ///< pointer to the beginning of A22
+    void *inplace; ///< in-place translation workspace, NULL if out of place
+    int ld;        ///< leading dimension of a PlasmaGeneralLapack matrix
+    plasma_tile_t *tiles; ///< tile table at the submatrix, NULL if none
 
     // tile parameters
     int mb; ///< number of rows in a tile
@@ -114,6 +131,18 @@ static inline void *plasma_tile_addr_general(plasma_desc_t A, int m, int n)
     return (void*)((char*)A.matrix + (offset*eltsize));
 }
 
+/******************************************************************************/
+static inline void *plasma_tile_addr_general_lapack(plasma_desc_t A,
+                                                    int m, int n)
+{
+    size_t mm = m + A.i/A.mb;
+    size_t nn = n + A.j/A.nb;
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t offset = A.mb*mm + A.nb*nn*A.ld;
+
+    return (void*)((char*)A.matrix + (offset*eltsize));
+}
+
 /******************************************************************************/
 static inline void *plasma_tile_addr_general_band(plasma_desc_t A, int m, int n)
 {
@@ -123,12 +152,20 @@ static inline void *plasma_tile_addr_general_band(plasma_desc_t A, int m, int n)
 /******************************************************************************/
 static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
 {
-    if (A.type == PlasmaGeneral) {
+    if (A.tiles != NULL) {
+        if (A.type == PlasmaGeneralBand)
+            m = (A.kut-1)+m-n;
+        return A.tiles[m + (size_t)A.gmt*n].addr;
+    }
+    else if (A.type == PlasmaGeneral) {
         return plasma_tile_addr_general(A, m, n);
     }
     else if (A.type == PlasmaGeneralBand) {
         return plasma_tile_addr_general_band(A, m, n);
     }
+    else if (A.type == PlasmaGeneralLapack) {
+        return plasma_tile_addr_general_lapack(A, m, n);
+    }
     else {
         plasma_fatal_error("invalid matrix type");
         return NULL;
@@ -137,12 +174,18 @@ static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
 
 /***************************************************************************//**
  *
- *  Returns the height of the tile with vertical position k.
+ *  Returns the height of the tile with vertical position k,
+ *  i.e., its leading dimension, which for a PlasmaGeneralLapack matrix
+ *  is the leading dimension of the whole matrix.
  *
  */
 static inline int plasma_tile_mmain(plasma_desc_t A, int k)
 {
-    if (A.i/A.mb+k < A.gm/A.mb)
+    if (A.tiles != NULL)
+        return A.tiles[k].ld;
+    else if (A.type == PlasmaGeneralLapack)
+        return A.ld;
+    else if (A.i/A.mb+k < A.gm/A.mb)
         return A.mb;
     else
         return A.gm%A.mb;
@@ -201,6 +244,47 @@ static inline int plasma_tile_mmain_band(plasma_desc_t A, int m, int n)
     return plasma_tile_mmain(A, (A.kut-1)+m-n);
 }
 
+/***************************************************************************//**
+ * @ingroup plasma_descriptor
+ *
+ * Statistics of the tile memory pool.
+ **/
+typedef struct {
+    size_t hits;      ///< buffers reused from the pool
+    size_t misses;    ///< buffers allocated with malloc()
+    size_t evictions; ///< cached buffers freed to stay within PlasmaPoolSize
+    size_t size;      ///< bytes currently cached
+    int num_blocks;   ///< buffers currently cached
+} plasma_pool_stats_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_descriptor
+ *
+ * Tile memory pool. Recycles the buffers of plasma_desc_general_create()
+ * and plasma_desc_destroy() by size class. Only buffers allocated by the pool
+ * are returned to it; any other buffer is freed as before.
+ **/
+typedef struct {
+    void *matrix; ///< buffer
+    size_t size;  ///< size class of the buffer in bytes
+    size_t age;   ///< pool clock at release, for trimming
+} plasma_pool_block_t;
+
+typedef struct {
+    plasma_pool_block_t *cached; ///< buffers available for reuse
+    int num_cached;              ///< number of cached buffers
+    int max_cached;              ///< capacity of cached
+    plasma_pool_block_t *live;   ///< buffers handed out by the pool
+    int num_live;                ///< number of live buffers
+    int max_live;                ///< capacity of live
+    size_t max_size;             ///< PlasmaPoolSize in bytes
+    plasma_enum_t trim;          ///< PlasmaPoolTrim
+    int huge_pages;              ///< PlasmaHugePages
+    size_t clock;                ///< number of releases so far
+    plasma_pool_stats_t stats;   ///< hits, misses, etc.
+    pthread_mutex_t lock;        ///< serializes access to the pool
+} plasma_pool_t;
+
 /******************************************************************************/
 int plasma_desc_general_create(plasma_enum_t dtyp, int mb, int nb,
                                int lm, int ln, int i, int j, int m, int n,
@@ -211,6 +295,11 @@ int plasma_desc_general_band_create(plasma_enum_t dtyp, plasma_enum_t uplo,
                                     int i, int j, int m, int n, int kl, int ku,
                                     plasma_desc_t *A);
 
+int plasma_desc_general_inplace_create(plasma_enum_t dtyp, void *pA, int lda,
+                                       int mb, int nb, int lm, int ln,
+                                       int i, int j, int m, int n,
+                                       plasma_desc_t *A);
+
 int plasma_desc_destroy(plasma_desc_t *A);
 
 int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
@@ -222,15 +311,41 @@ int plasma_desc_general_band_init(plasma_enum_t precision, plasma_enum_t uplo,
                                   int i, int j, int m, int n, int kl, int ku,
                                   plasma_desc_t *A);
 
+int plasma_desc_general_lapack_init(plasma_enum_t precision, void *matrix,
+                                    int ld, int mb, int nb, int lm, int ln,
+                                    int i, int j, int m, int n,
+                                    plasma_desc_t *A);
+
 int plasma_desc_check(plasma_desc_t A);
 int plasma_desc_general_check(plasma_desc_t A);
 int plasma_desc_general_band_check(plasma_desc_t A);
+int plasma_desc_general_lapack_check(plasma_desc_t A);
 
 plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n);
 
 int plasma_descT_create(plasma_desc_t A, int ib, plasma_enum_t householder_mode,
                         plasma_desc_t *T);
 
+int plasma_desc_tile_socket(plasma_desc_t A, plasma_enum_t placement,
+                            int num_sockets, int m, int n);
+void plasma_desc_place(plasma_desc_t A, plasma_enum_t placement,
+                       int num_sockets);
+
+void *plasma_desc_inplace_create(plasma_desc_t A);
+void plasma_desc_ge2desc_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence);
+void plasma_desc_desc2ge_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence);
+
+int plasma_desc_pool_stats(plasma_pool_stats_t *stats);
+int plasma_desc_pool_trim();
+
+void plasma_pool_init(plasma_pool_t *pool);
+void plasma_pool_finalize(plasma_pool_t *pool);
+void *plasma_pool_alloc(plasma_pool_t *pool, size_t size, int *fresh);
+void plasma_pool_free(plasma_pool_t *pool, void *matrix);
+void plasma_pool_set_size(plasma_pool_t *pool, size_t max_size);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -0,0 +1,91 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_DISPATCH_H
+#define ICL_PLASMA_DISPATCH_H
+
+#include "plasma_types.h"
+#include "plasma_descriptor.h"
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum number of sockets with a queue of their own
+#define PLASMA_DISPATCH_MAX_SOCKETS 64
+
+// maximum number of placed matrices whose tiles have an owner
+#define PLASMA_DISPATCH_MAX_MATRICES 64
+
+/***************************************************************************//**
+ * @ingroup plasma_dispatch
+ *
+ * Kernel handed to the socket owning its output tile. The core_omp_*()
+ * functions embed it as the first field of a struct holding the kernel
+ * arguments, which their OpenMP task keeps until the kernel is done.
+ **/
+typedef struct plasma_dispatch_task_s {
+    void (*run)(void *task);             ///< runs the kernel
+    int priority;                        ///< priority of the OpenMP task
+    volatile int done;                   ///< set once the kernel has run
+    struct plasma_dispatch_task_s *next; ///< next task in the queue
+} plasma_dispatch_task_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_dispatch
+ *
+ * Matrix whose tiles were placed by PlasmaTilePlacement. The owner of a
+ * tile is the socket that the placement put it on.
+ **/
+typedef struct {
+    const char *begin;       ///< first byte of the matrix
+    const char *end;         ///< past the last byte of the matrix
+    plasma_desc_t A;         ///< layout of the tiles
+    plasma_enum_t placement; ///< PlasmaTilePlacement
+    int num_sockets;         ///< number of sockets the tiles were placed on
+} plasma_dispatch_matrix_t;
+
+typedef struct {
+    pthread_mutex_t lock;                 ///< protects the queue
+    struct plasma_dispatch_task_s *head;  ///< task of highest priority
+} plasma_dispatch_queue_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_dispatch
+ *
+ * Placed matrices of a context, and the queues of the sockets. Sequences
+ * point at it if PlasmaTaskAffinity is enabled, as the threads running
+ * their tasks need not be attached to the context.
+ **/
+typedef struct plasma_dispatch_s {
+    pthread_mutex_t lock; ///< protects the matrices
+    plasma_dispatch_matrix_t matrices[PLASMA_DISPATCH_MAX_MATRICES];
+    int num_matrices;     ///< number of placed matrices
+    plasma_dispatch_queue_t queues[PLASMA_DISPATCH_MAX_SOCKETS];
+} plasma_dispatch_t;
+
+/******************************************************************************/
+void plasma_dispatch_init(plasma_dispatch_t *dispatch);
+void plasma_dispatch_finalize(plasma_dispatch_t *dispatch);
+
+void plasma_dispatch_add(plasma_dispatch_t *dispatch, plasma_desc_t A,
+                         plasma_enum_t placement, int num_sockets);
+void plasma_dispatch_remove(plasma_dispatch_t *dispatch, const void *matrix);
+
+void plasma_dispatch(plasma_dispatch_t *dispatch, const void *tile,
+                     plasma_dispatch_task_t *task);
+int plasma_thread_socket(int num_sockets);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_DISPATCH_H
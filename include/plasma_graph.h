@@ -0,0 +1,117 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_GRAPH_H
+#define ICL_PLASMA_GRAPH_H
+
+#include "plasma_types.h"
+#include "plasma_descriptor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum number of descriptors of a recorded call
+#define PLASMA_GRAPH_MAX_DESCS 3
+
+// maximum number of graphs cached by a context
+#define PLASMA_GRAPH_CACHE_SIZE 16
+
+/******************************************************************************/
+// Kernels of recorded tasks.
+enum {
+    PlasmaGraphGemm,
+    PlasmaGraphHerk,
+    PlasmaGraphPotrf,
+    PlasmaGraphSyrk,
+    PlasmaGraphTrsm
+};
+
+// Access of a task to a tile.
+enum {
+    PlasmaGraphNone,
+    PlasmaGraphIn,
+    PlasmaGraphInout
+};
+
+/***************************************************************************//**
+ * @ingroup plasma_graph
+ *
+ * Recorded task. The core_omp_*() functions fill in the kernel, its
+ * arguments and the tiles, in the order of the kernel arguments.
+ * plasma_graph_add() replaces the tile addresses by the descriptor
+ * holding them and the offset into its matrix.
+ **/
+typedef struct {
+    int kernel;                 ///< PlasmaGraphGemm, etc.
+    int priority;               ///< priority of the task
+    plasma_enum_t param[4];     ///< side, uplo, trans, diag, in kernel order
+    int dim[3];                 ///< m, n, k, in kernel order
+    plasma_complex64_t alpha;   ///< scalars of all precisions
+    plasma_complex64_t beta;
+    int iinfo;                  ///< offset of the info of a factorization
+    void *tile[3];              ///< tile addresses, while recording
+    int ld[3];                  ///< leading dimensions of the tiles
+    int access[3];              ///< PlasmaGraphIn, etc.
+    int desc[3];                ///< descriptors of the tiles
+    size_t offset[3];           ///< byte offsets of the tiles in them
+    int num_pred;               ///< number of predecessors
+    int succ;                   ///< first successor in the successor list
+    int num_succ;               ///< number of successors
+} plasma_graph_node_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_graph
+ *
+ * Tasks of a call of a routine recorded with their dependencies, for
+ * replaying them in later calls on descriptors of the same shape.
+ * The shape of a descriptor is all of its fields but the addresses.
+ **/
+typedef struct plasma_graph_s {
+    // key
+    const char *routine;       ///< name of the routine, e.g., "potrf"
+    plasma_enum_t uplo;        ///< uplo of the call
+    int lookahead;             ///< PlasmaLookahead, which sets priorities
+    int num_descs;             ///< number of descriptors
+    plasma_desc_t descs[PLASMA_GRAPH_MAX_DESCS]; ///< descriptors recorded
+
+    // tasks
+    plasma_graph_node_t *nodes; ///< tasks in order of creation
+    int num_nodes;              ///< number of tasks
+    int max_nodes;              ///< allocated number of tasks
+    int *succ;                  ///< successors of all tasks, by priority
+
+    // recording
+    int *edges;             ///< predecessor and successor of each dependency
+    int num_edges;          ///< number of dependencies
+    int max_edges;          ///< allocated number of dependencies
+    struct plasma_graph_tile_s *tiles; ///< open addressing hash table
+    int size;               ///< number of slots, a power of two
+    int count;              ///< number of used slots
+    int failed;             ///< set if the call cannot be recorded
+
+    struct plasma_graph_s *next; ///< next graph in the cache
+} plasma_graph_t;
+
+/******************************************************************************/
+plasma_graph_t *plasma_graph_find(const char *routine, plasma_enum_t uplo,
+                                  const plasma_desc_t *descs, int num_descs);
+int plasma_graph_create(const char *routine, plasma_enum_t uplo,
+                        const plasma_desc_t *descs, int num_descs,
+                        plasma_graph_t **graph);
+void plasma_graph_add(plasma_graph_t *graph, const plasma_graph_node_t *node);
+plasma_graph_t *plasma_graph_finalize(plasma_graph_t *graph);
+void plasma_graph_destroy(plasma_graph_t *graph);
+void plasma_graph_cache_clear(plasma_graph_t **cache);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_GRAPH_H
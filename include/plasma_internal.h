@@ -35,6 +35,35 @@ static inline int imax(int a, int b)
         return b;
 }
 
+/******************************************************************************/
+// Returns the priority of the tasks of step k of a factorization that
+// update tile column n, where n == k for the panel. With lookahead d,
+// the panel is first, then columns k+1, ..., k+d, which are the next d
+// panels, and the bulk of the trailing update last. With d == 0, all
+// tasks have the same priority.
+// OpenMP caps priorities at OMP_MAX_TASK_PRIORITY, which defaults to 0.
+static inline int plasma_lookahead_priority(int lookahead, int k, int n)
+{
+    if (n-k > lookahead)
+        return 0;
+    else
+        return lookahead-(n-k)+1;
+}
+
+/******************************************************************************/
+// Returns the number of problems of a batch to run in one task, given the
+// average flops of a problem, so that each task does enough work to hide
+// its overhead while each thread still gets several tasks.
+static inline int plasma_batch_group(int batch, double flops, int num_threads)
+{
+    const double min_task_flops = 1e6;
+    const int tasks_per_thread = 4;
+
+    int group = flops > 0.0 ? (int)(min_task_flops/flops)+1 : batch;
+    int max_group = imax(1, batch/(tasks_per_thread*num_threads));
+    return imax(1, imin(group, max_group));
+}
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
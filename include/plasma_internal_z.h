@@ -14,6 +14,7 @@
 
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
+#include "plasma_graph.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
@@ -34,6 +35,11 @@ void plasma_pzdesc2ge(plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pzdesc2ge_col(plasma_desc_t A,
+                          plasma_complex64_t *pA, int lda,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pzdesc2pb(plasma_desc_t A,
                       plasma_complex64_t *pA, int lda,
                       plasma_sequence_t *sequence,
@@ -44,6 +50,11 @@ void plasma_pzge2desc(plasma_complex64_t *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pzge2desc_col(plasma_complex64_t *pA, int lda,
+                          plasma_desc_t A,
+                          plasma_sequence_t *sequence,
+                          plasma_request_t *request);
+
 void plasma_pzgeadd(plasma_enum_t transa,
                     plasma_complex64_t alpha,  plasma_desc_t A,
                     plasma_complex64_t beta,   plasma_desc_t B,
@@ -77,6 +88,10 @@ void plasma_pzgetri_aux(plasma_desc_t A, plasma_desc_t W,
                         plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_pzgetrf(plasma_desc_t A, int *ipiv,
+                    int ib, int max_panel_threads, int lookahead,
+                    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_pzgraph(plasma_graph_t *graph, const plasma_desc_t *descs,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_pzhemm(plasma_enum_t side, plasma_enum_t uplo,
@@ -147,7 +162,7 @@ void plasma_pzpb2desc(plasma_complex64_t *pA, int lda,
 void plasma_pzpbtrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
-void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A,
+void plasma_pzpotrf(plasma_enum_t uplo, plasma_desc_t A, int lookahead,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
 void plasma_pzsymm(plasma_enum_t side, plasma_enum_t uplo,
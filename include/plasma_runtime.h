@@ -0,0 +1,71 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_RUNTIME_H
+#define ICL_PLASMA_RUNTIME_H
+
+#include "plasma_async.h"
+
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_async
+ *
+ * Call submitted by a plasma_*_async() function. Drivers embed the job
+ * as the first field of a struct holding their arguments and descriptors.
+ * run() creates the tasks of the call; finish() is called once they have
+ * completed, and frees the struct.
+ * The tuning of the call is copied from the context at submission, as the
+ * submitting thread may tune the context for its next call meanwhile;
+ * nb is that of the descriptors, created at submission.
+ **/
+typedef struct plasma_job_s {
+    void (*run)(struct plasma_job_s *job);    ///< creates the tasks
+    void (*finish)(struct plasma_job_s *job); ///< frees the job
+    plasma_sequence_t *sequence;              ///< sequence of the call
+    plasma_request_t request;                 ///< request of the call
+    int ib;                                   ///< PlasmaIb
+    int max_panel_threads;                    ///< PlasmaNumPanelThreads
+    int lookahead;                            ///< PlasmaLookahead
+    struct plasma_job_s *next;                ///< next job in the queue
+} plasma_job_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_async
+ *
+ * Thread of a context that creates the tasks of submitted jobs in its own
+ * OpenMP team. The thread is started by the first submitted job, and the
+ * team has one thread more than the context, since the thread creating
+ * the tasks sleeps while no jobs are queued.
+ **/
+typedef struct {
+    pthread_t thread;      ///< thread creating the tasks of jobs
+    int started;           ///< whether the thread was started
+    int stop;              ///< set to end the thread
+    pthread_mutex_t lock;  ///< protects the queue and pending counts
+    pthread_cond_t queued; ///< signals queued jobs or stop to the thread
+    pthread_cond_t done;   ///< signals completed jobs to waiting threads
+    plasma_job_t *head;    ///< first job in the queue
+    plasma_job_t *tail;    ///< last job in the queue
+} plasma_runtime_t;
+
+/******************************************************************************/
+void plasma_runtime_init(plasma_runtime_t *runtime);
+void plasma_runtime_finalize(plasma_runtime_t *runtime);
+int plasma_runtime_submit(plasma_job_t *job);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_RUNTIME_H
@@ -0,0 +1,102 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_STATS_H
+#define ICL_PLASMA_STATS_H
+
+#include "plasma_async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum number of kernels counted separately
+#define PLASMA_STATS_MAX_KERNELS 32
+
+// maximum number of threads counted separately
+#define PLASMA_STATS_MAX_THREADS 256
+
+/***************************************************************************//**
+ * @ingroup plasma_stats
+ *
+ * Counters of the tasks of a kernel.
+ **/
+typedef struct {
+    const char *name;    ///< core_omp_*() function, also for tasks of the
+                         ///< same kernel created otherwise, e.g., by
+                         ///< plasma_pzgetrf(), or in-place translation
+    long long num_tasks; ///< number of tasks
+    double time;         ///< seconds in the tasks
+    double flops;        ///< floating point operations of the tasks
+} plasma_kernel_stats_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_stats
+ *
+ * Statistics of the sequences destroyed since the last reset, kept by
+ * the context while PlasmaStats is enabled. Synchronous calls, e.g.,
+ * plasma_zposv(), count as one sequence each.
+ *
+ * The idle time of a thread is the wall time of the sequences minus the
+ * time it spent in their tasks, which includes waiting for dependencies
+ * and the time spent by the caller between async calls.
+ * Flops are counted for the Level 3 BLAS, Cholesky, LU panel, QR and LQ
+ * kernels from their leading terms.
+ **/
+typedef struct {
+    int num_sequences;        ///< number of sequences
+    double time;              ///< wall time of the sequences, in seconds
+    double flops;             ///< flops of all kernels
+    double translation_time;  ///< seconds translating between layouts
+    double barrier_time;      ///< seconds waiting at barriers of LU panels
+    int num_kernels;          ///< number of kernels counted
+    plasma_kernel_stats_t kernels[PLASMA_STATS_MAX_KERNELS];
+    int num_threads;          ///< number of threads counted
+    double idle_time[PLASMA_STATS_MAX_THREADS]; ///< per thread, in seconds
+} plasma_stats_t;
+
+/***************************************************************************//**
+ * @ingroup plasma_stats
+ *
+ * Counters of a sequence, with one slot per thread written only by the
+ * thread, which are added to the context when the sequence is destroyed.
+ **/
+typedef struct {
+    plasma_kernel_stats_t kernels[PLASMA_STATS_MAX_KERNELS];
+    int num_kernels;   ///< number of kernels counted
+    double busy_time;  ///< seconds in tasks
+    double translation_time; ///< seconds of the tasks translating layouts
+    double barrier_time; ///< seconds waiting at barriers of LU panels
+    int team_size;     ///< threads of the team that ran the tasks
+} plasma_stats_thread_t;
+
+typedef struct plasma_stats_s {
+    double start;                   ///< omp_get_wtime() at creation
+    int num_threads;                ///< number of slots
+    plasma_stats_thread_t *threads; ///< slots of the threads
+} plasma_stats_sequence_t;
+
+/******************************************************************************/
+int plasma_get_stats(plasma_stats_t *stats);
+int plasma_reset_stats();
+
+int plasma_stats_sequence_create(int num_threads,
+                                 plasma_stats_sequence_t **stats);
+void plasma_stats_sequence_destroy(plasma_stats_sequence_t *stats,
+                                   plasma_stats_t *total);
+void plasma_stats_task(plasma_stats_sequence_t *stats, const char *name,
+                       double fmas, double start, double stop);
+void plasma_stats_translation(plasma_stats_sequence_t *stats, double time);
+void plasma_stats_barrier(double time);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_STATS_H
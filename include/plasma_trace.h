@@ -0,0 +1,118 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef ICL_PLASMA_TRACE_H
+#define ICL_PLASMA_TRACE_H
+
+#include "plasma_async.h"
+#include "plasma_graph.h"
+
+#include <omp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ * @ingroup plasma_trace
+ *
+ * Hooks of the tasks of the core_omp_*() functions, which feed the trace
+ * and the statistics of the sequences. They read the clock only while
+ * tracing or statistics are enabled.
+ *
+ * Tracing is compiled in with -DPLASMA_TRACE (make trace=1) and enabled
+ * by setting the environment variable PLASMA_TRACE. Each thread records
+ * the kernel, the tile, the sequence and the start and stop times of the
+ * tasks it runs. At exit, the events are written as Chrome trace event
+ * JSON, which Perfetto and chrome://tracing display, and as SVG.
+ * Tasks recorded by PLASMA_TRACE_TASK() also record the memory they
+ * depend on, from which tools/critical_path.py rebuilds the task graph.
+ *
+ * Statistics are enabled by plasma_set(PlasmaStats, PlasmaEnabled),
+ * see plasma_get_stats().
+ **/
+extern int plasma_trace_enabled;
+extern int plasma_stats_enabled;
+
+// maximum number of dependencies recorded per task
+#define PLASMA_TRACE_MAX_DEPS 6
+
+// Memory a task depends on, as in its depend clause, with PlasmaGraphIn,
+// PlasmaGraphInout, or PlasmaGraphNone for memory only named in the trace.
+typedef struct {
+    const void *begin; ///< first byte
+    const void *end;   ///< byte after the last
+    int access;        ///< PlasmaGraphIn, etc.
+} plasma_trace_dep_t;
+
+void plasma_trace_event(const char *name, const void *tile, double fmas,
+                        double start, double stop,
+                        const plasma_sequence_t *sequence);
+void plasma_trace_task(const char *name, double fmas,
+                       double start, double stop,
+                       const plasma_sequence_t *sequence,
+                       const plasma_trace_dep_t *deps, int num_deps);
+void plasma_trace_translation(const char *name,
+                              double start, double stop,
+                              const plasma_sequence_t *sequence,
+                              const plasma_trace_dep_t *deps, int num_deps);
+
+// Starts timing a task.
+#define PLASMA_TRACE_START() \
+    double plasma_trace_start = \
+        (plasma_trace_enabled | plasma_stats_enabled) ? omp_get_wtime() : 0.0
+
+// Ends timing a task of the named kernel, which made fmas multiply-adds.
+#define PLASMA_TRACE_EVENT(name, tile, fmas, sequence) \
+    do { \
+        if (plasma_trace_start != 0.0) \
+            plasma_trace_event(name, tile, fmas, plasma_trace_start, \
+                               omp_get_wtime(), sequence); \
+    } while (0)
+
+// Ends timing a task of the named kernel, which made fmas multiply-adds,
+// with its dependencies, e.g., {A, A+lda*n, PlasmaGraphIn}. The first
+// Inout one names the task in the trace.
+#define PLASMA_TRACE_TASK(name, fmas, sequence, ...) \
+    do { \
+        if (plasma_trace_start != 0.0) { \
+            const plasma_trace_dep_t plasma_trace_deps[] = { __VA_ARGS__ }; \
+            plasma_trace_task(name, fmas, plasma_trace_start, \
+                              omp_get_wtime(), sequence, plasma_trace_deps, \
+                              (int)(sizeof(plasma_trace_deps) / \
+                                    sizeof(plasma_trace_deps[0]))); \
+        } \
+    } while (0)
+
+// Ends timing a task as PLASMA_TRACE_TASK() does, for a task translating
+// between layouts, which the statistics also count as translation.
+#define PLASMA_TRACE_TRANSLATION(name, sequence, ...) \
+    do { \
+        if (plasma_trace_start != 0.0) { \
+            const plasma_trace_dep_t plasma_trace_deps[] = { __VA_ARGS__ }; \
+            plasma_trace_translation(name, plasma_trace_start, \
+                                     omp_get_wtime(), sequence, \
+                                     plasma_trace_deps, \
+                                     (int)(sizeof(plasma_trace_deps) / \
+                                           sizeof(plasma_trace_deps[0]))); \
+        } \
+    } while (0)
+
+// Ends timing a task of the calling core_omp_*() function.
+#define PLASMA_TRACE_STOP(tile, sequence) \
+    PLASMA_TRACE_EVENT(__func__, tile, 0.0, sequence)
+
+/******************************************************************************/
+void plasma_trace_init();
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // ICL_PLASMA_TRACE_H
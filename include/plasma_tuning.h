@@ -23,8 +23,11 @@ extern "C" {
 /******************************************************************************/
 lua_State *plasma_tuning_init();
 void plasma_tuning_finalize(lua_State *L);
-void plasma_tune_getrf(plasma_context_t *plasma, plasma_enum_t dtyp,
-					   int m, int n);
+void plasma_tuning_cache_init(plasma_context_t *plasma);
+void plasma_tuning_cache_finalize(plasma_context_t *plasma);
+void plasma_tuning_cache_set(plasma_context_t *plasma, plasma_enum_t param);
+void plasma_tune(plasma_context_t *plasma, const char *routine,
+                 plasma_enum_t dtyp, int m, int n, int k);
 
 #ifdef __cplusplus
 }  // extern "C"
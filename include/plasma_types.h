@@ -67,6 +67,7 @@ enum {
     PlasmaLower         = 122,
     PlasmaGeneral       = 123,
     PlasmaGeneralBand   = 124,
+    PlasmaGeneralLapack = 125,
 
     PlasmaNonUnit       = 131,
     PlasmaUnit          = 132,
@@ -103,7 +104,11 @@ enum {
     PlasmaErrorInternal,
     PlasmaErrorSequence,
     PlasmaErrorComponent,
-    PlasmaErrorEnvironment
+    PlasmaErrorEnvironment,
+
+    // Negative and far below the -i of an illegal i-th argument, as a
+    // failed factorization leaves its positive info in the status.
+    PlasmaErrorCanceled = -1000
 };
 
 enum {
@@ -116,6 +121,18 @@ enum {
     PlasmaTreeHouseholder
 };
 
+enum {
+    PlasmaPlacementNone,
+    PlasmaPlacementColumnCyclic,
+    PlasmaPlacementSocketCyclic,
+    PlasmaPlacementInterleave
+};
+
+enum {
+    PlasmaPoolTrimOldest,
+    PlasmaPoolTrimNewest
+};
+
 enum {
     PlasmaDisabled = 0,
     PlasmaEnabled = 1
@@ -127,7 +144,17 @@ enum {
     PlasmaIb,
     PlasmaInplaceOutplace,
     PlasmaNumPanelThreads,
-    PlasmaHouseholderMode
+    PlasmaHouseholderMode,
+    PlasmaPoolSize,
+    PlasmaPoolTrim,
+    PlasmaTilePlacement,
+    PlasmaNumSockets,
+    PlasmaTaskAffinity,
+    PlasmaHugePages,
+    PlasmaTileTable,
+    PlasmaLookahead,
+    PlasmaTaskGraph,
+    PlasmaStats
 };
 
 /******************************************************************************/
@@ -21,17 +21,26 @@ extern "C" {
 
 typedef struct {
     void **spaces;      ///< array of nthread pointers to workspaces
+    int *busy;          ///< array of nthread flags of workspaces in use
+    size_t size;        ///< size in bytes of each workspace
     size_t lwork;       ///< length in elements of workspace on each core
     int nthread;        ///< number of threads
     plasma_enum_t dtyp; ///< precision of the workspace
+    int huge_pages;     ///< PlasmaHugePages
 } plasma_workspace_t;
 
 /******************************************************************************/
 int plasma_workspace_create(plasma_workspace_t *work, size_t lwork,
                            plasma_enum_t dtyp);
 
+int plasma_workspace_reserve(plasma_workspace_t *work, size_t lwork,
+                             plasma_enum_t dtyp);
+
 int plasma_workspace_destroy(plasma_workspace_t *work);
 
+void *plasma_workspace_acquire(plasma_workspace_t work, int *slot);
+void plasma_workspace_release(plasma_workspace_t work, int slot, void *space);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
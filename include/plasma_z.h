@@ -67,6 +67,24 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
                                            plasma_complex64_t *pB, int ldb,
                  plasma_complex64_t beta,  plasma_complex64_t *pC, int ldc);
 
+int plasma_zgemm_batch(plasma_enum_t transa, plasma_enum_t transb,
+                       int m, int n, int k,
+                       plasma_complex64_t alpha,
+                       plasma_complex64_t **pA, int lda,
+                       plasma_complex64_t **pB, int ldb,
+                       plasma_complex64_t beta,
+                       plasma_complex64_t **pC, int ldc,
+                       int batch);
+
+int plasma_zgemm_vbatch(plasma_enum_t transa, plasma_enum_t transb,
+                        const int *m, const int *n, const int *k,
+                        plasma_complex64_t alpha,
+                        plasma_complex64_t **pA, const int *lda,
+                        plasma_complex64_t **pB, const int *ldb,
+                        plasma_complex64_t beta,
+                        plasma_complex64_t **pC, const int *ldc,
+                        int batch);
+
 int plasma_zgeqrf(int m, int n,
                   plasma_complex64_t *pA, int lda,
                   plasma_desc_t *T);
@@ -80,9 +98,22 @@ int plasma_zgesv(int n, int nrhs,
                  plasma_complex64_t *pA, int lda, int *ipiv,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zgesv_async(int n, int nrhs,
+                       plasma_complex64_t *pA, int lda, int *ipiv,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_sequence_t *sequence);
+
 int plasma_zgetrf(int m, int n,
                   plasma_complex64_t *pA, int lda, int *ipiv);
 
+int plasma_zgetrf_batch(int m, int n,
+                        plasma_complex64_t **pA, int lda, int **ipiv,
+                        int *info, int batch);
+
+int plasma_zgetrf_vbatch(const int *m, const int *n,
+                         plasma_complex64_t **pA, const int *lda, int **ipiv,
+                         int *info, int batch);
+
 int plasma_zgetri(int n, plasma_complex64_t *pA, int lda, int *ipiv);
 
 int plasma_zgetri_aux(int n, plasma_complex64_t *pA, int lda);
@@ -91,6 +122,16 @@ int plasma_zgetrs(int n, int nrhs,
                   plasma_complex64_t *pA, int lda, int *ipiv,
                   plasma_complex64_t *pB, int ldb);
 
+int plasma_zgetrs_batch(int n, int nrhs,
+                        plasma_complex64_t **pA, int lda, int **ipiv,
+                        plasma_complex64_t **pB, int ldb,
+                        int batch);
+
+int plasma_zgetrs_vbatch(const int *n, const int *nrhs,
+                         plasma_complex64_t **pA, const int *lda, int **ipiv,
+                         plasma_complex64_t **pB, const int *ldb,
+                         int batch);
+
 int plasma_zhemm(plasma_enum_t side, plasma_enum_t uplo,
                  int m, int n,
                  plasma_complex64_t alpha, plasma_complex64_t *pA, int lda,
@@ -185,10 +226,26 @@ int plasma_zposv(plasma_enum_t uplo,
                  plasma_complex64_t *pA, int lda,
                  plasma_complex64_t *pB, int ldb);
 
+int plasma_zposv_async(plasma_enum_t uplo,
+                       int n, int nrhs,
+                       plasma_complex64_t *pA, int lda,
+                       plasma_complex64_t *pB, int ldb,
+                       plasma_sequence_t *sequence);
+
 int plasma_zpotrf(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
 
+int plasma_zpotrf_batch(plasma_enum_t uplo,
+                        int n,
+                        plasma_complex64_t **pA, int lda,
+                        int *info, int batch);
+
+int plasma_zpotrf_vbatch(plasma_enum_t uplo,
+                         const int *n,
+                         plasma_complex64_t **pA, const int *lda,
+                         int *info, int batch);
+
 int plasma_zpotri(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
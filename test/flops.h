@@ -672,6 +672,47 @@ static double  flops_dormlq(plasma_enum_t side, double m, double n, double k)
 static double  flops_sormlq(plasma_enum_t side, double m, double n, double k)
     { return    fmuls_unmlq(side, m, n, k) +    fadds_unmlq(side, m, n, k); }
 
+//------------------------------------------------------------ tsmqr
+// Applies the k reflectors of tsqrt, with m-by-k V, to an n-column tile
+// pair from the left.
+static double fmuls_tsmqr(double m, double n, double k)
+    { return 2.*m*n*k; }
+
+static double fadds_tsmqr(double m, double n, double k)
+    { return 2.*m*n*k; }
+
+static double  flops_ztsmqr(double m, double n, double k)
+    { return 6.*fmuls_tsmqr(m, n, k) + 2.*fadds_tsmqr(m, n, k); }
+
+static double  flops_ctsmqr(double m, double n, double k)
+    { return 6.*fmuls_tsmqr(m, n, k) + 2.*fadds_tsmqr(m, n, k); }
+
+static double  flops_dtsmqr(double m, double n, double k)
+    { return    fmuls_tsmqr(m, n, k) +    fadds_tsmqr(m, n, k); }
+
+static double  flops_stsmqr(double m, double n, double k)
+    { return    fmuls_tsmqr(m, n, k) +    fadds_tsmqr(m, n, k); }
+
+//------------------------------------------------------------ ttmqr
+// As tsmqr, with the upper trapezoidal V of ttqrt.
+static double fmuls_ttmqr(double m, double n, double k)
+    { return (m >= k) ? (n*k*k + n*k) : (2.*m*n*k - n*m*m + n*m); }
+
+static double fadds_ttmqr(double m, double n, double k)
+    { return fmuls_ttmqr(m, n, k); }
+
+static double  flops_zttmqr(double m, double n, double k)
+    { return 6.*fmuls_ttmqr(m, n, k) + 2.*fadds_ttmqr(m, n, k); }
+
+static double  flops_cttmqr(double m, double n, double k)
+    { return 6.*fmuls_ttmqr(m, n, k) + 2.*fadds_ttmqr(m, n, k); }
+
+static double  flops_dttmqr(double m, double n, double k)
+    { return    fmuls_ttmqr(m, n, k) +    fadds_ttmqr(m, n, k); }
+
+static double  flops_sttmqr(double m, double n, double k)
+    { return    fmuls_ttmqr(m, n, k) +    fadds_ttmqr(m, n, k); }
+
 //------------------------------------------------------------ trtri
 static double fmuls_trtri(double n)
     { return 1./6.*n*n*n + 0.5*n*n + 1./3.*n; }
@@ -11,11 +11,14 @@
 #include "plasma.h"
 
 #include <assert.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 
+#include <omp.h>
+
 /******************************************************************************/
 typedef void (*test_func_ptr)(param_value_t param[], bool run);
 
@@ -28,6 +31,66 @@ struct routines_t {
 // use { "", NULL }  entries for missing precisions.
 struct routines_t routines[] =
 {
+    { "barrier", test_barrier },
+    { "", NULL },
+    { "", NULL },
+    { "", NULL },
+
+    { "context", test_context },
+    { "", NULL },
+    { "", NULL },
+    { "", NULL },
+
+    { "tasks", test_tasks },
+    { "", NULL },
+    { "", NULL },
+    { "", NULL },
+
+    { "stats", test_stats },
+    { "", NULL },
+    { "", NULL },
+    { "", NULL },
+
+    { "core_zgemm", test_core_zgemm },
+    { "core_dgemm", test_core_dgemm },
+    { "core_cgemm", test_core_cgemm },
+    { "core_sgemm", test_core_sgemm },
+
+    { "core_zgeqrt", test_core_zgeqrt },
+    { "core_dgeqrt", test_core_dgeqrt },
+    { "core_cgeqrt", test_core_cgeqrt },
+    { "core_sgeqrt", test_core_sgeqrt },
+
+    { "core_zgetrf", test_core_zgetrf },
+    { "core_dgetrf", test_core_dgetrf },
+    { "core_cgetrf", test_core_cgetrf },
+    { "core_sgetrf", test_core_sgetrf },
+
+    { "core_zherk", test_core_zherk },
+    { "core_dsyrk", test_core_dsyrk },
+    { "core_cherk", test_core_cherk },
+    { "core_ssyrk", test_core_ssyrk },
+
+    { "core_zpotrf", test_core_zpotrf },
+    { "core_dpotrf", test_core_dpotrf },
+    { "core_cpotrf", test_core_cpotrf },
+    { "core_spotrf", test_core_spotrf },
+
+    { "core_ztrsm", test_core_ztrsm },
+    { "core_dtrsm", test_core_dtrsm },
+    { "core_ctrsm", test_core_ctrsm },
+    { "core_strsm", test_core_strsm },
+
+    { "core_ztsmqr", test_core_ztsmqr },
+    { "core_dtsmqr", test_core_dtsmqr },
+    { "core_ctsmqr", test_core_ctsmqr },
+    { "core_stsmqr", test_core_stsmqr },
+
+    { "core_zttmqr", test_core_zttmqr },
+    { "core_dttmqr", test_core_dttmqr },
+    { "core_cttmqr", test_core_cttmqr },
+    { "core_sttmqr", test_core_sttmqr },
+
     { "dzamax", test_dzamax },
     { "damax",  test_damax  },
     { "scamax", test_scamax },
@@ -73,6 +136,11 @@ struct routines_t routines[] =
     { "cgemm", test_cgemm },
     { "sgemm", test_sgemm },
 
+    { "zgemm_batch", test_zgemm_batch },
+    { "dgemm_batch", test_dgemm_batch },
+    { "cgemm_batch", test_cgemm_batch },
+    { "sgemm_batch", test_sgemm_batch },
+
     { "zgeqrf", test_zgeqrf },
     { "dgeqrf", test_dgeqrf },
     { "cgeqrf", test_cgeqrf },
@@ -98,6 +166,11 @@ struct routines_t routines[] =
     { "cgetrf", test_cgetrf },
     { "sgetrf", test_sgetrf },
 
+    { "zgetrf_batch", test_zgetrf_batch },
+    { "dgetrf_batch", test_dgetrf_batch },
+    { "cgetrf_batch", test_cgetrf_batch },
+    { "sgetrf_batch", test_sgetrf_batch },
+
     { "zgetri", test_zgetri },
     { "dgetri", test_dgetri },
     { "cgetri", test_cgetri },
@@ -113,6 +186,11 @@ struct routines_t routines[] =
     { "cgetrs", test_cgetrs },
     { "sgetrs", test_sgetrs },
 
+    { "zgetrs_batch", test_zgetrs_batch },
+    { "dgetrs_batch", test_dgetrs_batch },
+    { "cgetrs_batch", test_cgetrs_batch },
+    { "sgetrs_batch", test_sgetrs_batch },
+
     { "zhemm", test_zhemm },
     { "", NULL },
     { "chemm", test_chemm },
@@ -208,6 +286,11 @@ struct routines_t routines[] =
     { "cpotrf", test_cpotrf },
     { "spotrf", test_spotrf },
 
+    { "zpotrf_batch", test_zpotrf_batch },
+    { "dpotrf_batch", test_dpotrf_batch },
+    { "cpotrf_batch", test_cpotrf_batch },
+    { "spotrf_batch", test_spotrf_batch },
+
     { "zpotri", test_zpotri },
     { "dpotri", test_dpotri },
     { "cpotri", test_cpotri },
@@ -320,6 +403,21 @@ static param_desc_t ParamDesc[] = {
     {"--tol=",             "tol",          0,     false,
      "tolerance [default: 50.0]"},
 
+    {"--warmup=",          "warmup",       0,     false,
+     "number of untested, untimed runs before those of each set of\n"
+     INDENT "parameters [default: 1 with --bench=y, else 0]"},
+
+    {"--flush=[y|n]",      "flush",        0,     false,
+     "flush the caches before each timed run [default: n]"},
+
+    {"--bench=[y|n]",      "bench",        0,     false,
+     "print the min, median, mean and standard deviation of the times\n"
+     INDENT "of the runs of each set of parameters [default: n]"},
+
+    {"--stats=[y|n]",      "stats",        0,     false,
+     "write the PLASMA statistics of the runs, summed over them, to\n"
+     INDENT "--output; use --test=n to leave out the checks [default: n]"},
+
     //------------------------------------------------------
     // function input parameters
     //------------------------------------------------------
@@ -351,8 +449,37 @@ static param_desc_t ParamDesc[] = {
     {"--hmode=[f|t]",      "House. mode",  11,    true,
      "Householder mode for QR/LQ - flat or tree [default: f]"},
 
+    {"--place=[n|c|s|i]",  "place",        5,     true,
+     "tile placement - none, column cyclic, socket cyclic, interleave\n"
+     INDENT "[default: n]"},
+
+    {"--affinity=[y|n]",   "affinity",     8,     true,
+     "run gemm, trsm, herk tasks on the socket owning their output tile;\n"
+     INDENT "no effect without --place or with one socket [default: n]"},
+
+    {"--huge=[y|n]",       "huge",         4,     true,
+     "allocate tiles and workspaces with huge pages [default: n]"},
+
+    {"--inplace=[y|n]",    "inplace",      7,     true,
+     "translate to tile layout in place [default: n]"},
+
+    {"--table=[y|n]",      "table",        5,     true,
+     "look up tiles in a table of tile addresses [default: y]"},
+
+    {"--vary=[y|n]",       "vary",         4,     true,
+     "vary the sizes of the problems in a batch up to --dim [default: n]"},
+
+    {"--graph=[y|n]",      "graph",        5,     true,
+     "record the tasks of the first call of each shape and replay them "
+     "in later calls, e.g., with --iter [default: n]"},
+
+    {"--cancel=[y|n]",     "cancel",       6,     true,
+     "cancel the sequence of --async calls right after submitting them\n"
+     INDENT "[default: n]"},
+
     {"--dim=",             "Dimensions",   6,     true,
-     "M x N x K dimensions [default: 1000 x 1000 x 1000]\n"
+     "M x N x K dimensions [default: 1000 x 1000 x 1000,\n"
+     INDENT "64 x 64 x 64 for batch routines]\n"
      INDENT "M, N, K can each be a single value or a range.\n"
      INDENT "N and K are optional; if not given, N=M and K=N.\n"
      INDENT "Ex: --dim=100:300:100x64 is 100x64x64, 200x64x64, 300x64x64."},
@@ -364,7 +491,8 @@ static param_desc_t ParamDesc[] = {
      "Upper bandwidth [default: 200]"},
 
     {"--nrhs=",            "nrhs",         6,     true,
-     "NHRS dimension (number of columns) [default: 1000]"},
+     "NHRS dimension (number of columns) [default: 1000,\n"
+     INDENT "64 for batch routines]"},
 
     {"--nb=",              "nb",           4,     true,
      "NB size of tile (NB by NB) [default: 256]"},
@@ -390,15 +518,34 @@ static param_desc_t ParamDesc[] = {
     {"--mtpf=",            "mtpf",         4,     true,
      "maximum number of threads for panel factorization [default: 1]"},
 
+    {"--lookahead=",       "lookahead",    9,     true,
+     "number of panels prioritized over trailing updates [default: 1]\n"
+     INDENT "Priorities need OMP_MAX_TASK_PRIORITY set.\n"
+     INDENT "Ex: --lookahead=0:4 sweeps the depth."},
+
     {"--zerocol=",         "zerocol",      7,     true,
      "if positive, a column of zeros inserted at that index [default: -1]"},
 
     {"--incx=",            "incx",         4,     true,
      "1 to pivot forward, -1 to pivot backward [default: 1]"},
 
+    {"--callers=",         "callers",      7,     true,
+     "number of application threads calling PLASMA concurrently\n"
+     INDENT "[default: 1]"},
+
+    {"--batch=",           "batch",        6,     true,
+     "number of problems in a batch [default: 1000]"},
+
+    {"--async=",           "async",        5,     true,
+     "number of solves submitted at once by plasma_*_async(), "
+     "or 0 for the blocking call [default: 0]"},
+
     { NULL }  // last entry
 };
 
+// file of the statistics of the runs, set by --output
+static const char *OutputFile = NULL;
+
 /***************************************************************************//**
  *
  * @brief Tests and times a PLASMA routine.
@@ -432,22 +579,56 @@ int main(int argc, char **argv)
 
     param_init(param);
     param_read(argc, argv, param);
-    int  iter  = param[PARAM_ITER].val[0].i;
-    bool outer = param[PARAM_OUTER].val[0].c == 'y';
-    bool test  = param[PARAM_TEST].val[0].c == 'y';
+    int  iter   = param[PARAM_ITER].val[0].i;
+    bool outer  = param[PARAM_OUTER].val[0].c == 'y';
+    bool test   = param[PARAM_TEST].val[0].c == 'y';
+    int  warmup = param[PARAM_WARMUP].val[0].i;
+    bool bench  = param[PARAM_BENCH].val[0].c == 'y';
+    bool stats  = param[PARAM_STATS].val[0].c == 'y';
     int err = 0;
 
+    // times and rates of the runs of a set of parameters
+    double *time = (double*)malloc(imax(1, iter)*sizeof(double));
+    assert(time != NULL);
+    double *gflops = (double*)malloc(imax(1, iter)*sizeof(double));
+    assert(gflops != NULL);
+
     // Print labels.
     param_snap(param, pval);
     print_header(routine, pval);
+    if (OutputFile != NULL && bench_open(OutputFile, routine, pval) != 0) {
+        printf("cannot open output file: %s\n", OutputFile);
+        return EXIT_FAILURE;
+    }
 
     // Iterate over parameters and run tests
     plasma_init();
         do {
             param_snap(param, pval);
+            // Warm-up runs are neither tested nor printed.
+            for (int i = 0; i < warmup; i++) {
+                param_value_t wval[PARAM_SIZEOF];
+                memcpy(wval, pval, sizeof(wval));
+                wval[PARAM_TEST].c = 'n';
+                run_routine(routine, wval, true);
+            }
+            if (stats) {
+                plasma_set(PlasmaStats, PlasmaEnabled);
+                plasma_reset_stats();
+            }
+            bool pass = true;
             for (int i = 0; i < iter; i++) {
             err += test_routine(routine, pval, test);
+            time[i] = pval[PARAM_TIME].d;
+            gflops[i] = pval[PARAM_GFLOPS].d;
+            pass = pass && pval[PARAM_SUCCESS].i;
             }
+            if (stats)
+                plasma_set(PlasmaStats, PlasmaDisabled);
+            if (bench)
+                bench_print(pval, iter, warmup, time, gflops);
+            if (OutputFile != NULL)
+                bench_write(pval, iter, warmup, time, gflops, test, pass);
             if (iter > 1) {
                 printf("\n");
             }
@@ -455,6 +636,10 @@ int main(int argc, char **argv)
     while (outer ? param_step_outer(param, 0) : param_step_inner(param));
     plasma_finalize();
     printf("\n");
+    if (OutputFile != NULL)
+        bench_close();
+    free(time);
+    free(gflops);
     return err;
 }
 
@@ -502,6 +687,12 @@ void print_routine_usage(const char *name, param_value_t pval[])
     print_usage(PARAM_DIM_OUTER);
     print_usage(PARAM_TEST);
     print_usage(PARAM_TOL);
+    print_usage(PARAM_WARMUP);
+    print_usage(PARAM_FLUSH);
+    print_usage(PARAM_BENCH);
+    print_usage(PARAM_STATS);
+    printf("\t%*s%s\n", DescriptionIndent, "--output=",
+           "write the statistics of the runs to a .json or .csv file");
 
     printf("\n"
            "Options below accept multiple values separated by commas\n"
@@ -623,6 +814,14 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_COLROW:
             case PARAM_NORM:
             case PARAM_HMODE:
+            case PARAM_PLACEMENT:
+            case PARAM_AFFINITY:
+            case PARAM_HUGE:
+            case PARAM_INPLACE:
+            case PARAM_TABLE:
+            case PARAM_VARY:
+            case PARAM_GRAPH:
+            case PARAM_CANCEL:
                 printf("  %*c", ParamDesc[i].width, pval[i].c);
                 break;
 
@@ -646,8 +845,12 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_PADB:
             case PARAM_PADC:
             case PARAM_MTPF:
+            case PARAM_LOOKAHEAD:
             case PARAM_ZEROCOL:
             case PARAM_INCX:
+            case PARAM_CALLERS:
+            case PARAM_BATCH:
+            case PARAM_ASYNC:
                 printf("  %*d", ParamDesc[i].width, pval[i].i);
                 break;
 
@@ -750,6 +953,10 @@ void param_read(int argc, char **argv, param_t param[])
     param_add_char('n', &param[PARAM_DIM_OUTER]);
     param_add_char('y', &param[PARAM_TEST]);
     param_add_double(50.0, &param[PARAM_TOL]);
+    param_add_int(-1, &param[PARAM_WARMUP]);
+    param_add_char('n', &param[PARAM_FLUSH]);
+    param_add_char('n', &param[PARAM_BENCH]);
+    param_add_char('n', &param[PARAM_STATS]);
 
     //================================================================
     // Initialize parameters from the command line.
@@ -764,6 +971,12 @@ void param_read(int argc, char **argv, param_t param[])
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_DIM_OUTER]);
         else if (param_starts_with(argv[i], "--test="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_TEST]);
+        else if (param_starts_with(argv[i], "--flush="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_FLUSH]);
+        else if (param_starts_with(argv[i], "--bench="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_BENCH]);
+        else if (param_starts_with(argv[i], "--stats="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_STATS]);
 
         else if (param_starts_with(argv[i], "--side="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_SIDE]);
@@ -790,11 +1003,38 @@ void param_read(int argc, char **argv, param_t param[])
         else if (param_starts_with(argv[i], "--hmode="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_HMODE]);
 
+        else if (param_starts_with(argv[i], "--place="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_PLACEMENT]);
+
+        else if (param_starts_with(argv[i], "--affinity="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_AFFINITY]);
+
+        else if (param_starts_with(argv[i], "--huge="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_HUGE]);
+
+        else if (param_starts_with(argv[i], "--inplace="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_INPLACE]);
+
+        else if (param_starts_with(argv[i], "--table="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_TABLE]);
+        else if (param_starts_with(argv[i], "--vary="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_VARY]);
+        else if (param_starts_with(argv[i], "--graph="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_GRAPH]);
+        else if (param_starts_with(argv[i], "--cancel="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_CANCEL]);
+
         //--------------------------------------------------
         // Scan integer parameters.
         //--------------------------------------------------
         else if (param_starts_with(argv[i], "--iter="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ITER]);
+        else if (param_starts_with(argv[i], "--warmup="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_WARMUP]);
 
         else if (param_starts_with(argv[i], "--dim=")) {
             bool outer = param[PARAM_DIM_OUTER].val[0].c == 'y';
@@ -823,10 +1063,19 @@ void param_read(int argc, char **argv, param_t param[])
 
         else if (param_starts_with(argv[i], "--mtpf="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_MTPF]);
+        else if (param_starts_with(argv[i], "--lookahead="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                                 &param[PARAM_LOOKAHEAD]);
         else if (param_starts_with(argv[i], "--zerocol="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ZEROCOL]);
         else if (param_starts_with(argv[i], "--incx="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_INCX]);
+        else if (param_starts_with(argv[i], "--callers="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_CALLERS]);
+        else if (param_starts_with(argv[i], "--batch="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_BATCH]);
+        else if (param_starts_with(argv[i], "--async="))
+            err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_ASYNC]);
 
         //--------------------------------------------------
         // Scan double precision parameters.
@@ -834,6 +1083,12 @@ void param_read(int argc, char **argv, param_t param[])
         else if (param_starts_with(argv[i], "--tol="))
             err = param_scan_double(strchr(argv[i], '=')+1, &param[PARAM_TOL]);
 
+        //--------------------------------------------------
+        // Scan file names.
+        //--------------------------------------------------
+        else if (param_starts_with(argv[i], "--output="))
+            OutputFile = strchr(argv[i], '=')+1;
+
         //--------------------------------------------------
         // Scan complex parameters.
         //--------------------------------------------------
@@ -865,6 +1120,11 @@ void param_read(int argc, char **argv, param_t param[])
         }
     }
 
+    // Benchmarks warm up once by default.
+    if (param[PARAM_WARMUP].val[0].i < 0)
+        param[PARAM_WARMUP].val[0].i =
+            param[PARAM_BENCH].val[0].c == 'y' ? 1 : 0;
+
     //================================================================
     // Set default values for uninitialized list parameters.
     //================================================================
@@ -890,12 +1150,32 @@ void param_read(int argc, char **argv, param_t param[])
         param_add_char('o', &param[PARAM_NORM]);
     if (param[PARAM_HMODE].num == 0)
         param_add_char('f', &param[PARAM_HMODE]);
+    if (param[PARAM_PLACEMENT].num == 0)
+        param_add_char('n', &param[PARAM_PLACEMENT]);
+    if (param[PARAM_AFFINITY].num == 0)
+        param_add_char('n', &param[PARAM_AFFINITY]);
+    if (param[PARAM_HUGE].num == 0)
+        param_add_char('n', &param[PARAM_HUGE]);
+    if (param[PARAM_INPLACE].num == 0)
+        param_add_char('n', &param[PARAM_INPLACE]);
+    if (param[PARAM_TABLE].num == 0)
+        param_add_char('y', &param[PARAM_TABLE]);
+    if (param[PARAM_VARY].num == 0)
+        param_add_char('n', &param[PARAM_VARY]);
+    if (param[PARAM_GRAPH].num == 0)
+        param_add_char('n', &param[PARAM_GRAPH]);
+    if (param[PARAM_CANCEL].num == 0)
+        param_add_char('n', &param[PARAM_CANCEL]);
 
     //--------------------------------------------------
     // Set integer parameters.
     //--------------------------------------------------
+    // Batch routines default to batches of small problems.
+    bool batch = strstr(routine, "_batch") != NULL;
     if (param[PARAM_DIM].num == 0) {
         int3_t dim = { 1000, 1000, 1000 };
+        if (batch)
+            dim.m = dim.n = dim.k = 64;
         param_add_int3(dim, &param[PARAM_DIM]);
     }
     if (param[PARAM_KL].num == 0)
@@ -903,7 +1183,7 @@ void param_read(int argc, char **argv, param_t param[])
     if (param[PARAM_KU].num == 0)
         param_add_int(200, &param[PARAM_KU]);
     if (param[PARAM_NRHS].num == 0)
-        param_add_int(1000, &param[PARAM_NRHS]);
+        param_add_int(batch ? 64 : 1000, &param[PARAM_NRHS]);
 
     if (param[PARAM_NB].num == 0)
         param_add_int(256, &param[PARAM_NB]);
@@ -919,10 +1199,18 @@ void param_read(int argc, char **argv, param_t param[])
 
     if (param[PARAM_MTPF].num == 0)
         param_add_int(1, &param[PARAM_MTPF]);
+    if (param[PARAM_LOOKAHEAD].num == 0)
+        param_add_int(1, &param[PARAM_LOOKAHEAD]);
     if (param[PARAM_ZEROCOL].num == 0)
         param_add_int(-1, &param[PARAM_ZEROCOL]);
     if (param[PARAM_INCX].num == 0)
         param_add_int(1, &param[PARAM_INCX]);
+    if (param[PARAM_CALLERS].num == 0)
+        param_add_int(1, &param[PARAM_CALLERS]);
+    if (param[PARAM_BATCH].num == 0)
+        param_add_int(1000, &param[PARAM_BATCH]);
+    if (param[PARAM_ASYNC].num == 0)
+        param_add_int(0, &param[PARAM_ASYNC]);
 
     //--------------------------------------------------
     // Set double precision parameters.
@@ -1454,3 +1742,450 @@ int param_snap(param_t param[], param_value_t pval[])
     }
     return 0;
 }
+
+//==============================================================================
+// benchmark mode
+//==============================================================================
+
+// size of the buffer written to flush the caches, larger than the last
+// level caches of current processors
+static const long FlushSize = 256L*1024*1024;
+
+// Macros of the compiler describing the build.
+#define BENCH_STR_(x) #x
+#define BENCH_STR(x) BENCH_STR_(x)
+
+static const char *BuildInfo[][2] = {
+#ifdef __VERSION__
+    { "compiler", __VERSION__ },
+#endif
+#ifdef _OPENMP
+    { "openmp",   BENCH_STR(_OPENMP) },
+#endif
+#ifdef __OPTIMIZE__
+    { "optimize", "y" },
+#else
+    { "optimize", "n" },
+#endif
+#ifdef NDEBUG
+    { "assert",   "n" },
+#else
+    { "assert",   "y" },
+#endif
+#ifdef PLASMA_WITH_MKL
+    { "mkl",      "y" },
+#else
+    { "mkl",      "n" },
+#endif
+#ifdef PLASMA_TRACE
+    { "trace",    "y" },
+#else
+    { "trace",    "n" },
+#endif
+#if defined(__AVX512F__)
+    { "isa",      "avx512f" },
+#elif defined(__AVX2__)
+    { "isa",      "avx2" },
+#elif defined(__AVX__)
+    { "isa",      "avx" },
+#elif defined(__SSE2__)
+    { "isa",      "sse2" },
+#elif defined(__ARM_NEON)
+    { "isa",      "neon" },
+#elif defined(__VSX__)
+    { "isa",      "vsx" },
+#else
+    { "isa",      "generic" },
+#endif
+};
+
+static const int NumBuildInfo = sizeof(BuildInfo)/sizeof(BuildInfo[0]);
+
+// output file of the statistics, as JSON or CSV
+static FILE *BenchFile = NULL;
+static bool BenchJson = false;
+static const char *BenchRoutine = NULL;
+static int BenchNumRecords = 0;
+
+// statistics of the runs of a set of parameters
+typedef struct {
+    double min, median, mean, stddev, max;
+} bench_stats_t;
+
+/***************************************************************************//**
+ *
+ * @brief Flushes the caches, if --flush=y, by writing a buffer larger than
+ *        the last level caches from all threads.
+ *        Routines call it right before starting their timers.
+ *
+ * @param[in] param - array of parameter values
+ *
+ ******************************************************************************/
+void test_flush_cache(param_value_t param[])
+{
+    static char *buffer = NULL;
+
+    if (param[PARAM_FLUSH].c != 'y')
+        return;
+
+    if (buffer == NULL) {
+        buffer = (char*)calloc(FlushSize, 1);
+        assert(buffer != NULL);
+    }
+    // One write per cache line evicts the lines of the matrices.
+    #pragma omp parallel for
+    for (long i = 0; i < FlushSize; i += 64)
+        buffer[i]++;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Returns whether a tile kernel test should call the kernel again.
+ *        Kernels on small tiles run in microseconds, so each test averages
+ *        several calls: with warm caches until they take 10 ms in total,
+ *        and after flushing the caches (--flush=y), 5 calls.
+ *
+ * @param[in] param - array of parameter values
+ * @param[in] calls - number of timed calls so far
+ * @param[in] time  - total time of the calls
+ *
+ ******************************************************************************/
+bool test_kernel_repeat(param_value_t param[], int calls, double time)
+{
+    if (param[PARAM_FLUSH].c == 'y')
+        return calls < 5;
+    else
+        return time < 0.01 && calls < 10000;
+}
+
+/******************************************************************************/
+static int bench_compare(const void *a, const void *b)
+{
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/******************************************************************************/
+// Returns the statistics of n values, with the sample standard deviation.
+static bench_stats_t bench_stats(const double x[], int n)
+{
+    bench_stats_t stats = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+    if (n <= 0)
+        return stats;
+
+    double *sorted = (double*)malloc(n*sizeof(double));
+    assert(sorted != NULL);
+    memcpy(sorted, x, n*sizeof(double));
+    qsort(sorted, n, sizeof(double), bench_compare);
+
+    stats.min = sorted[0];
+    stats.max = sorted[n-1];
+    stats.median = n % 2 == 1 ? sorted[n/2] :
+                                0.5*(sorted[n/2-1] + sorted[n/2]);
+    for (int i = 0; i < n; i++)
+        stats.mean += x[i];
+    stats.mean /= n;
+    if (n > 1) {
+        double sum = 0.0;
+        for (int i = 0; i < n; i++)
+            sum += (x[i]-stats.mean)*(x[i]-stats.mean);
+        stats.stddev = sqrt(sum/(n-1));
+    }
+    free(sorted);
+    return stats;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Prints the statistics of the runs of a set of parameters.
+ *
+ * @param[in] pval   - array of parameter values
+ * @param[in] iter   - number of runs
+ * @param[in] warmup - number of warm-up runs before them
+ * @param[in] time   - times of the runs
+ * @param[in] gflops - rates of the runs
+ *
+ ******************************************************************************/
+void bench_print(param_value_t pval[], int iter, int warmup,
+                 const double time[], const double gflops[])
+{
+    bench_stats_t t = bench_stats(time, iter);
+    bench_stats_t g = bench_stats(gflops, iter);
+    printf("  %d runs after %d warm-up, %s caches: time min %.4f, "
+           "median %.4f, mean %.4f, stddev %.4f (%.1f%%); "
+           "Gflop/s median %.4f, max %.4f\n",
+           iter, warmup, pval[PARAM_FLUSH].c == 'y' ? "cold" : "hot",
+           t.min, t.median, t.mean, t.stddev,
+           t.mean > 0.0 ? 100.0*t.stddev/t.mean : 0.0,
+           g.median, g.max);
+}
+
+/******************************************************************************/
+// Writes the input parameters used by the routine, either their names,
+// the options without the dashes, or their values, for CSV, or both,
+// for JSON.
+static void bench_write_params(param_value_t pval[], bool names, bool values)
+{
+    const char *sep = "";
+    for (int i = PARAM_GFLOPS+1; i < PARAM_SIZEOF; i++) {
+        if (! pval[i].used)
+            continue;
+
+        if (i == PARAM_DIM) {
+            const char *dim_names[] = { "m", "n", "k" };
+            int dims[] = { pval[i].dim.m, pval[i].dim.n, pval[i].dim.k };
+            for (int d = 0; d < 3; d++) {
+                if (pval[i].used & (PARAM_USE_M << d)) {
+                    fprintf(BenchFile, "%s", sep);
+                    if (names)
+                        fprintf(BenchFile, BenchJson ? "\"%s\": " : "%s",
+                                dim_names[d]);
+                    if (values)
+                        fprintf(BenchFile, "%d", dims[d]);
+                    sep = BenchJson ? ", " : ",";
+                }
+            }
+            continue;
+        }
+
+        fprintf(BenchFile, "%s", sep);
+        sep = BenchJson ? ", " : ",";
+        if (names) {
+            const char *arg = ParamDesc[i].arg+2;
+            int len = (int)strcspn(arg, "=");
+            fprintf(BenchFile, BenchJson ? "\"%.*s\": " : "%.*s", len, arg);
+        }
+        if (! values)
+            continue;
+
+        const char *quote = BenchJson ? "\"" : "";
+        switch (i) {
+        // character parameters
+        case PARAM_TRANS:
+        case PARAM_TRANSA:
+        case PARAM_TRANSB:
+        case PARAM_SIDE:
+        case PARAM_UPLO:
+        case PARAM_DIAG:
+        case PARAM_COLROW:
+        case PARAM_NORM:
+        case PARAM_HMODE:
+        case PARAM_PLACEMENT:
+        case PARAM_AFFINITY:
+        case PARAM_HUGE:
+        case PARAM_INPLACE:
+        case PARAM_TABLE:
+        case PARAM_VARY:
+        case PARAM_GRAPH:
+        case PARAM_CANCEL:
+            fprintf(BenchFile, "%s%c%s", quote, pval[i].c, quote);
+            break;
+
+        // complex parameters
+        case PARAM_ALPHA:
+        case PARAM_BETA:
+            fprintf(BenchFile, "%s%.4f%+.4fi%s", quote,
+                    creal(pval[i].z), cimag(pval[i].z), quote);
+            break;
+
+        // integer parameters
+        default:
+            fprintf(BenchFile, "%d", pval[i].i);
+            break;
+        }
+    }
+}
+
+/******************************************************************************/
+// Writes the statistics of values, as JSON members or CSV fields.
+static void bench_write_stats(const char *name, const double x[], int n)
+{
+    bench_stats_t stats = bench_stats(x, n);
+    if (BenchJson) {
+        fprintf(BenchFile,
+                "\"%s\": {\"min\": %.6g, \"median\": %.6g, \"mean\": %.6g, "
+                "\"stddev\": %.6g, \"max\": %.6g, \"runs\": [",
+                name, stats.min, stats.median, stats.mean,
+                stats.stddev, stats.max);
+        for (int i = 0; i < n; i++)
+            fprintf(BenchFile, "%s%.6g", i > 0 ? ", " : "", x[i]);
+        fprintf(BenchFile, "]}");
+    }
+    else {
+        fprintf(BenchFile, "%.6g,%.6g,%.6g,%.6g,%.6g",
+                stats.min, stats.median, stats.mean, stats.stddev, stats.max);
+    }
+}
+
+/******************************************************************************/
+// Writes the PLASMA statistics of the runs, with all kernels for JSON,
+// or the times in tasks, in translations and idle for CSV.
+static void bench_write_plasma_stats()
+{
+    plasma_stats_t *stats = (plasma_stats_t*)malloc(sizeof(plasma_stats_t));
+    assert(stats != NULL);
+    plasma_get_stats(stats);
+
+    double kernel_time = 0.0;
+    for (int i = 0; i < stats->num_kernels; i++)
+        kernel_time += stats->kernels[i].time;
+    double idle_time = 0.0;
+    for (int t = 0; t < stats->num_threads; t++)
+        idle_time += stats->idle_time[t];
+
+    if (BenchJson) {
+        fprintf(BenchFile,
+                "\"stats\": {\"sequences\": %d, \"time\": %.6g, "
+                "\"flops\": %.6g, \"translation_time\": %.6g, "
+                "\"barrier_time\": %.6g, \"kernel_time\": %.6g, "
+                "\"idle_time\": %.6g, \"threads\": %d, \"kernels\": [",
+                stats->num_sequences, stats->time, stats->flops,
+                stats->translation_time, stats->barrier_time, kernel_time,
+                idle_time, stats->num_threads);
+        for (int i = 0; i < stats->num_kernels; i++) {
+            plasma_kernel_stats_t *kernel = &stats->kernels[i];
+            fprintf(BenchFile,
+                    "%s\n  {\"name\": \"%s\", \"tasks\": %lld, "
+                    "\"time\": %.6g, \"flops\": %.6g}",
+                    i > 0 ? "," : "", kernel->name, kernel->num_tasks,
+                    kernel->time, kernel->flops);
+        }
+        fprintf(BenchFile, "]}");
+    }
+    else {
+        fprintf(BenchFile, "%.6g,%.6g,%.6g,%.6g",
+                stats->time, stats->translation_time, kernel_time,
+                idle_time);
+    }
+    free(stats);
+}
+
+/***************************************************************************//**
+ *
+ * @brief Opens the file of the statistics of the runs, and writes the
+ *        routine, the number of threads and the build for JSON, or the
+ *        header for CSV. Files ending in .json are JSON, others are CSV.
+ *
+ * @param[in] file_name - name of the file
+ * @param[in] name      - routine name
+ * @param[in] pval      - array of parameter values, marking those used
+ *
+ * @retval 0 - success
+ * @retval -1 - the file cannot be opened
+ *
+ ******************************************************************************/
+int bench_open(const char *file_name, const char *name, param_value_t pval[])
+{
+    BenchFile = fopen(file_name, "w");
+    if (BenchFile == NULL)
+        return -1;
+
+    const char *ext = strrchr(file_name, '.');
+    BenchJson = ext != NULL && strcmp(ext, ".json") == 0;
+    BenchRoutine = name;
+    BenchNumRecords = 0;
+
+    if (BenchJson) {
+        fprintf(BenchFile,
+                "{\"routine\": \"%s\", \"threads\": %d, \"build\": {",
+                name, omp_get_max_threads());
+        for (int i = 0; i < NumBuildInfo; i++)
+            fprintf(BenchFile, "%s\"%s\": \"%s\"", i > 0 ? ", " : "",
+                    BuildInfo[i][0], BuildInfo[i][1]);
+        fprintf(BenchFile, "},\n\"results\": [");
+    }
+    else {
+        fprintf(BenchFile, "routine,threads,");
+        bench_write_params(pval, true, false);
+        fprintf(BenchFile,
+                ",plasma_nb,plasma_ib,iter,warmup,flush,status,"
+                "time_min,time_median,time_mean,time_stddev,time_max,"
+                "gflops_min,gflops_median,gflops_mean,gflops_stddev,"
+                "gflops_max,");
+        if (pval[PARAM_STATS].c == 'y')
+            fprintf(BenchFile, "stats_time,translation_time,kernel_time,"
+                               "idle_time,");
+        fprintf(BenchFile, "build\n");
+    }
+    return 0;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Writes the statistics of the runs of a set of parameters, with
+ *        the tile and inner block sizes PLASMA ran with, and with
+ *        --stats=y, the PLASMA statistics of the runs.
+ *
+ * @param[in] pval   - array of parameter values
+ * @param[in] iter   - number of runs
+ * @param[in] warmup - number of warm-up runs before them
+ * @param[in] time   - times of the runs
+ * @param[in] gflops - rates of the runs
+ * @param[in] test   - whether the runs were tested
+ * @param[in] pass   - whether all tested runs passed
+ *
+ ******************************************************************************/
+void bench_write(param_value_t pval[], int iter, int warmup,
+                 const double time[], const double gflops[], bool test,
+                 bool pass)
+{
+    int nb, ib;
+    plasma_get(PlasmaNb, &nb);
+    plasma_get(PlasmaIb, &ib);
+    const char *status = ! test ? "--" : pass ? "pass" : "FAILED";
+
+    if (BenchJson) {
+        fprintf(BenchFile, "%s\n{\"params\": {",
+                BenchNumRecords > 0 ? "," : "");
+        bench_write_params(pval, true, true);
+        fprintf(BenchFile,
+                "}, \"plasma_nb\": %d, \"plasma_ib\": %d, \"iter\": %d, "
+                "\"warmup\": %d, \"flush\": \"%c\", \"status\": \"%s\",\n ",
+                nb, ib, iter, warmup, pval[PARAM_FLUSH].c, status);
+        bench_write_stats("time", time, iter);
+        fprintf(BenchFile, ",\n ");
+        bench_write_stats("gflops", gflops, iter);
+        if (pval[PARAM_STATS].c == 'y') {
+            fprintf(BenchFile, ",\n ");
+            bench_write_plasma_stats();
+        }
+        fprintf(BenchFile, "}");
+    }
+    else {
+        fprintf(BenchFile, "%s,%d,", BenchRoutine, omp_get_max_threads());
+        bench_write_params(pval, false, true);
+        fprintf(BenchFile, ",%d,%d,%d,%d,%c,%s,",
+                nb, ib, iter, warmup, pval[PARAM_FLUSH].c, status);
+        bench_write_stats("time", time, iter);
+        fprintf(BenchFile, ",");
+        bench_write_stats("gflops", gflops, iter);
+        fprintf(BenchFile, ",");
+        if (pval[PARAM_STATS].c == 'y') {
+            bench_write_plasma_stats();
+            fprintf(BenchFile, ",");
+        }
+        fprintf(BenchFile, "\"");
+        for (int i = 0; i < NumBuildInfo; i++)
+            fprintf(BenchFile, "%s%s=%s", i > 0 ? ";" : "",
+                    BuildInfo[i][0], BuildInfo[i][1]);
+        fprintf(BenchFile, "\"\n");
+    }
+    BenchNumRecords++;
+    fflush(BenchFile);
+}
+
+/***************************************************************************//**
+ *
+ * @brief Closes the file of the statistics of the runs.
+ *
+ ******************************************************************************/
+void bench_close()
+{
+    if (BenchFile == NULL)
+        return;
+    if (BenchJson)
+        fprintf(BenchFile, "\n]}\n");
+    fclose(BenchFile);
+    BenchFile = NULL;
+}
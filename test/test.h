@@ -36,6 +36,10 @@ typedef enum {
     PARAM_DIM_OUTER, // outer product iteration for dimensions M, N, K?
     PARAM_TEST,    // test the solution?
     PARAM_TOL,     // tolerance
+    PARAM_WARMUP,  // number of untimed runs
+    PARAM_FLUSH,   // flush the caches before timed runs?
+    PARAM_BENCH,   // print statistics of the runs?
+    PARAM_STATS,   // record PLASMA statistics of the runs?
 
     //------------------------------------------------------
     // function input parameters
@@ -50,6 +54,14 @@ typedef enum {
     PARAM_UPLO,    // general rectangular or upper or lower triangular
     PARAM_DIAG,    // non-unit or unit diagonal
     PARAM_HMODE,   // Householder mode - tree or flat
+    PARAM_PLACEMENT, // tile placement policy
+    PARAM_AFFINITY,  // owner-computes task affinity
+    PARAM_HUGE,    // huge page allocation of tiles and workspaces
+    PARAM_INPLACE, // in-place translation to tile layout
+    PARAM_TABLE,   // table of tile addresses in descriptors
+    PARAM_VARY,    // varying sizes of the problems in a batch
+    PARAM_GRAPH,   // replay of recorded tasks
+    PARAM_CANCEL,  // cancel of asynchronous calls right after submission
 
     // numeric params
     PARAM_DIM,     // M, N, K dimensions
@@ -64,8 +76,12 @@ typedef enum {
     PARAM_PADB,    // padding of B
     PARAM_PADC,    // padding of C
     PARAM_MTPF,    // maximum number of threads for panel factorization
+    PARAM_LOOKAHEAD, // number of panels run ahead of the trailing update
     PARAM_ZEROCOL, // if positive, a column of zeros inserted at that index
     PARAM_INCX,    // 1 to pivot forward, -1 to pivot backward
+    PARAM_CALLERS, // number of application threads calling PLASMA
+    PARAM_BATCH,   // number of problems in a batch
+    PARAM_ASYNC,   // number of solves submitted at once by the async API
 
     //------------------------------------------------------
     // Keep at the end!
@@ -148,6 +164,24 @@ void param_add_complex(plasma_complex64_t zval, param_t *param);
 int  param_step_inner(param_t param[]);
 int  param_step_outer(param_t param[], int idx);
 int  param_snap(param_t param[], param_value_t value[]);
+void test_flush_cache(param_value_t param[]);
+bool test_kernel_repeat(param_value_t param[], int calls, double time);
+void bench_print(param_value_t pval[], int iter, int warmup,
+                 const double time[], const double gflops[]);
+int  bench_open(const char *file_name, const char *name,
+                param_value_t pval[]);
+void bench_write(param_value_t pval[], int iter, int warmup,
+                 const double time[], const double gflops[], bool test,
+                 bool pass);
+void bench_close();
+
+//==============================================================================
+// test routines without precisions
+//==============================================================================
+void test_barrier(param_value_t param[], bool run);
+void test_context(param_value_t param[], bool run);
+void test_tasks(param_value_t param[], bool run);
+void test_stats(param_value_t param[], bool run);
 
 //==============================================================================
 static inline int imin(int a, int b)
@@ -167,6 +201,31 @@ static inline int imax(int a, int b)
         return b;
 }
 
+//==============================================================================
+// Converts the --place character to the PLASMA tile placement policy.
+static inline plasma_enum_t placement_const(char c)
+{
+    switch (c) {
+    case 'c': return PlasmaPlacementColumnCyclic;
+    case 's': return PlasmaPlacementSocketCyclic;
+    case 'i': return PlasmaPlacementInterleave;
+    default:  return PlasmaPlacementNone;
+    }
+}
+
+//==============================================================================
+// Returns the size of problem i of a batch: dim, or with --vary=y, a size
+// between 1 and dim, spread by a multiplicative hash of i, so that runs
+// are repeatable.
+static inline int batch_size(int dim, int i, char vary)
+{
+    if (vary != 'y' || dim <= 0)
+        return dim;
+
+    unsigned int hash = (unsigned int)i*2654435761u;
+    return 1 + (int)(hash % (unsigned int)dim);
+}
+
 #include "test_s.h"
 #include "test_d.h"
 #include "test_ds.h"
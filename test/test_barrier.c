@@ -0,0 +1,80 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "test.h"
+#include "plasma.h"
+#include "plasma_barrier.h"
+
+#include <assert.h>
+
+#include <omp.h>
+
+// number of barriers per thread
+static const int NumWaits = 1000000;
+
+/***************************************************************************//**
+ *
+ * @brief Times the barrier of the panel threads.
+ *        A team of --mtpf threads passes 10^6 barriers, so time in ms
+ *        equals the latency of one barrier in ns.
+ *        Each thread counts its arrivals, so that each barrier checks
+ *        that all threads arrived and none passed early.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_barrier(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_MTPF  ].used = true;
+    param[PARAM_ERROR ].used = false;
+    param[PARAM_GFLOPS].used = false;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int size = param[PARAM_MTPF].i;
+    assert(size > 0);
+
+    //================================================================
+    // Run and time the barriers.
+    //================================================================
+    plasma_barrier_t barrier;
+    plasma_barrier_init(&barrier);
+
+    int arrived = 0;
+    int mismatch = 0;
+    plasma_time_t start = omp_get_wtime();
+    #pragma omp parallel num_threads(size)
+    {
+        // Threads may run ahead by one arrival after each barrier.
+        // A smaller team than requested would never pass.
+        for (int i = 0; i < NumWaits && omp_get_num_threads() == size; i++) {
+            __sync_fetch_and_add(&arrived, 1);
+            plasma_barrier_wait(&barrier, size);
+            int count = __sync_fetch_and_add(&arrived, 0);
+            if (count < (i+1)*size || count > (i+2)*size)
+                __sync_fetch_and_add(&mismatch, 1);
+        }
+    }
+    plasma_time_t stop = omp_get_wtime();
+    param[PARAM_TIME].d = stop-start;
+
+    //================================================================
+    // Test that no thread passed a barrier early.
+    //================================================================
+    param[PARAM_SUCCESS].i = (mismatch == 0 && arrived == NumWaits*size);
+}
@@ -92,6 +92,7 @@ void test_clag2z(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     retval = plasma_clag2z(m, n, As, ldas, A, lda);
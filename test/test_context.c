@@ -0,0 +1,140 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "test.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <omp.h>
+
+// number of context lookups per caller
+static const int NumLookups = 1000000;
+
+typedef struct {
+    volatile int *num_ready;    // number of callers ready to start
+    int num_callers;            // number of callers
+    plasma_context_t *context;  // context seen by the caller
+    plasma_time_t time;         // time of the lookups
+    int success;                // whether the lookups were consistent
+} caller_t;
+
+/******************************************************************************/
+static void *context_caller(void *arg)
+{
+    caller_t *caller = (caller_t*)arg;
+    caller->success = 0;
+
+    // Attach a context to this thread.
+    if (plasma_init() != PlasmaSuccess) {
+        __sync_fetch_and_add(caller->num_ready, 1);
+        return NULL;
+    }
+    caller->context = plasma_context_self();
+
+    // Wait for all callers, so that the lookups overlap.
+    __sync_fetch_and_add(caller->num_ready, 1);
+    while (*caller->num_ready < caller->num_callers)
+        sched_yield();
+
+    int mismatch = 0;
+    plasma_time_t start = omp_get_wtime();
+    for (int i = 0; i < NumLookups; i++)
+        mismatch += plasma_context_self() != caller->context;
+    plasma_time_t stop = omp_get_wtime();
+    caller->time = stop-start;
+
+    caller->success = (caller->context != NULL && mismatch == 0);
+    plasma_finalize();
+    return NULL;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Times the lookup of the PLASMA context.
+ *        Each caller thread attaches its own context, performs 10^6 lookups,
+ *        and detaches. Time is for the slowest caller, so time in ms
+ *        equals the per-call overhead in ns.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_context(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_CALLERS].used = true;
+    param[PARAM_ERROR  ].used = false;
+    param[PARAM_GFLOPS ].used = false;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int num_callers = param[PARAM_CALLERS].i;
+    assert(num_callers > 0);
+
+    //================================================================
+    // Allocate callers.
+    //================================================================
+    pthread_t *threads = (pthread_t*)malloc(num_callers*sizeof(pthread_t));
+    assert(threads != NULL);
+
+    caller_t *callers = (caller_t*)malloc(num_callers*sizeof(caller_t));
+    assert(callers != NULL);
+
+    //================================================================
+    // Run and time the lookups.
+    //================================================================
+    volatile int num_ready = 0;
+    for (int i = 0; i < num_callers; i++) {
+        callers[i].num_ready = &num_ready;
+        callers[i].num_callers = num_callers;
+        callers[i].context = NULL;
+        callers[i].time = 0.0;
+        int retval = pthread_create(&threads[i], NULL,
+                                    context_caller, &callers[i]);
+        assert(retval == 0);
+    }
+    for (int i = 0; i < num_callers; i++)
+        pthread_join(threads[i], NULL);
+
+    plasma_time_t time = 0.0;
+    for (int i = 0; i < num_callers; i++)
+        if (callers[i].time > time)
+            time = callers[i].time;
+
+    param[PARAM_TIME].d = time;
+
+    //================================================================
+    // Test that each caller saw its own context.
+    //================================================================
+    int success = 1;
+    for (int i = 0; i < num_callers; i++) {
+        success &= callers[i].success;
+        for (int j = 0; j < i; j++)
+            success &= callers[i].context != callers[j].context;
+    }
+    param[PARAM_SUCCESS].i = success;
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(threads);
+    free(callers);
+}
@@ -0,0 +1,154 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CORE_ZGEMM on tiles.
+ *        Times the update C = C - A*B of NB-by-NB tiles, as in the trailing
+ *        updates of the factorizations.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_core_zgemm(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_TRANSA].used = true;
+    param[PARAM_TRANSB].used = true;
+    param[PARAM_NB    ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t transb = plasma_trans_const(param[PARAM_TRANSB].c);
+
+    int nb = param[PARAM_NB].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double eps = LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t size = (size_t)nb*nb;
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *B =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    plasma_complex64_t *C =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(C != NULL);
+
+    plasma_complex64_t *Cref =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(Cref != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, size, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_zlarnv(1, seed, size, B);
+    assert(retval == 0);
+
+    retval = LAPACKE_zlarnv(1, seed, size, Cref);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time the kernel, restoring C before each call.
+    //================================================================
+    plasma_complex64_t zmone = -1.0;
+    plasma_complex64_t zone  =  1.0;
+
+    plasma_time_t time = 0.0;
+    int calls = 0;
+    do {
+        memcpy(C, Cref, size*sizeof(plasma_complex64_t));
+        test_flush_cache(param);
+        plasma_time_t start = omp_get_wtime();
+        core_zgemm(transa, transb, nb, nb, nb,
+                   zmone, A, nb,
+                          B, nb,
+                   zone,  C, nb);
+        plasma_time_t stop = omp_get_wtime();
+        time += stop-start;
+        calls++;
+    } while (test_kernel_repeat(param, calls, time));
+    time /= calls;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zgemm(nb, nb, nb) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        // |alpha| = |beta| = 1
+        double work[1];
+        double Anorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, nb, A, nb, work);
+        double Bnorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, nb, B, nb, work);
+        double Cnorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, nb, Cref, nb, work);
+
+        cblas_zgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                    nb, nb, nb,
+                    CBLAS_SADDR(zmone), A, nb,
+                                        B, nb,
+                    CBLAS_SADDR(zone),  Cref, nb);
+
+        cblas_zaxpy(size, CBLAS_SADDR(zmone), Cref, 1, C, 1);
+
+        double error = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, nb, C, nb, work);
+        double normalize = sqrt((double)nb+2) * Anorm * Bnorm + 2 * Cnorm;
+        if (normalize != 0)
+            error /= normalize;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < 3*eps;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(C);
+    free(Cref);
+}
@@ -0,0 +1,135 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CORE_ZGEQRT on tiles.
+ *        Times the QR factorization of an NB-by-NB tile with inner blocking
+ *        IB, as the diagonal tiles of plasma_pzgeqrf().
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_core_zgeqrt(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_NB].used = true;
+    param[PARAM_IB].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int nb = param[PARAM_NB].i;
+    int ib = param[PARAM_IB].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t size = (size_t)nb*nb;
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *Aref =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(Aref != NULL);
+
+    plasma_complex64_t *T =
+        (plasma_complex64_t*)malloc((size_t)ib*nb*sizeof(plasma_complex64_t));
+    assert(T != NULL);
+
+    plasma_complex64_t *tau =
+        (plasma_complex64_t*)malloc((size_t)nb*sizeof(plasma_complex64_t));
+    assert(tau != NULL);
+
+    plasma_complex64_t *work =
+        (plasma_complex64_t*)malloc((size_t)ib*nb*sizeof(plasma_complex64_t));
+    assert(work != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, size, Aref);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time the kernel, restoring A before each call.
+    //================================================================
+    plasma_time_t time = 0.0;
+    int calls = 0;
+    do {
+        memcpy(A, Aref, size*sizeof(plasma_complex64_t));
+        test_flush_cache(param);
+        plasma_time_t start = omp_get_wtime();
+        core_zgeqrt(nb, nb, ib, A, nb, T, ib, tau, work);
+        plasma_time_t stop = omp_get_wtime();
+        time += stop-start;
+        calls++;
+    } while (test_kernel_repeat(param, calls, time));
+    time /= calls;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zgeqrf(nb, nb) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing R and the reflectors to those of LAPACK.
+    //================================================================
+    if (test) {
+        double rwork[1];
+        double Anorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, nb, Aref, nb, rwork);
+
+        LAPACKE_zgeqrf(LAPACK_COL_MAJOR, nb, nb, Aref, nb, tau);
+
+        plasma_complex64_t zmone = -1.0;
+        cblas_zaxpy(size, CBLAS_SADDR(zmone), Aref, 1, A, 1);
+
+        double error = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, nb, A, nb, rwork);
+        if (Anorm != 0)
+            error /= Anorm;
+        error /= nb;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(Aref);
+    free(T);
+    free(tau);
+    free(work);
+}
@@ -0,0 +1,147 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CORE_ZGETRF on tiles.
+ *        Times the LU factorization with partial pivoting of an NB-by-NB
+ *        tile by one thread, with inner blocking IB, as the panel of
+ *        plasma_pzgetrf() on a single tile.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_core_zgetrf(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_NB].used = true;
+    param[PARAM_IB].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int nb = param[PARAM_NB].i;
+    int ib = param[PARAM_IB].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_desc_t A;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                        nb, nb, 0, 0, nb, nb, &A);
+    assert(retval == PlasmaSuccess);
+    plasma_complex64_t *a = (plasma_complex64_t*)plasma_tile_addr(A, 0, 0);
+
+    size_t size = (size_t)nb*nb;
+    plasma_complex64_t *Aref =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(Aref != NULL);
+
+    int *ipiv = (int*)malloc((size_t)nb*sizeof(int));
+    assert(ipiv != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    retval = LAPACKE_zlarnv(1, seed, size, Aref);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time the kernel, restoring A before each call.
+    //================================================================
+    volatile int max_idx[1];
+    volatile plasma_complex64_t max_val[1];
+    volatile int info = 0;
+
+    plasma_barrier_t barrier;
+    plasma_barrier_init(&barrier);
+
+    plasma_time_t time = 0.0;
+    int calls = 0;
+    do {
+        memcpy(a, Aref, size*sizeof(plasma_complex64_t));
+        info = 0;
+        test_flush_cache(param);
+        plasma_time_t start = omp_get_wtime();
+        core_zgetrf(A, ipiv, ib, 0, 1, max_idx, max_val, &info, &barrier);
+        plasma_time_t stop = omp_get_wtime();
+        time += stop-start;
+        calls++;
+    } while (test_kernel_repeat(param, calls, time));
+    time /= calls;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zgetrf(nb, nb) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation,
+    // as in test_zgetrf.c.
+    //================================================================
+    if (test) {
+        int *ipivref = (int*)malloc((size_t)nb*sizeof(int));
+        assert(ipivref != NULL);
+
+        int lapinfo = LAPACKE_zgetrf(LAPACK_COL_MAJOR, nb, nb,
+                                     Aref, nb, ipivref);
+        if (lapinfo == info &&
+            memcmp(ipiv, ipivref, (size_t)nb*sizeof(int)) == 0) {
+            double work[1];
+            double Anorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', nb, nb, Aref, nb, work);
+
+            plasma_complex64_t zmone = -1.0;
+            cblas_zaxpy(size, CBLAS_SADDR(zmone), Aref, 1, a, 1);
+
+            double error = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', nb, nb, a, nb, work);
+            if (Anorm != 0)
+                error /= Anorm;
+            error /= nb;
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+        free(ipivref);
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    plasma_desc_destroy(&A);
+    free(Aref);
+    free(ipiv);
+}
@@ -0,0 +1,138 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define A(i_, j_) A[(i_) + (size_t)nb*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests CORE_ZPOTRF on tiles.
+ *        Times the Cholesky factorization of an NB-by-NB diagonal tile.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_core_zpotrf(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_UPLO].used = true;
+    param[PARAM_NB  ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int nb = param[PARAM_NB].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t size = (size_t)nb*nb;
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *Aref =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(Aref != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, size, A);
+    assert(retval == 0);
+
+    // Make A Hermitian positive definite, as in test_zpotrf.c.
+    for (int i = 0; i < nb; i++) {
+        A(i, i) = creal(A(i, i)) + nb;
+        for (int j = 0; j < i; j++) {
+            A(j, i) = conj(A(i, j));
+        }
+    }
+    memcpy(Aref, A, size*sizeof(plasma_complex64_t));
+
+    //================================================================
+    // Run and time the kernel, restoring A before each call.
+    //================================================================
+    int coreinfo = 0;
+
+    plasma_time_t time = 0.0;
+    int calls = 0;
+    do {
+        memcpy(A, Aref, size*sizeof(plasma_complex64_t));
+        test_flush_cache(param);
+        plasma_time_t start = omp_get_wtime();
+        coreinfo = core_zpotrf(uplo, nb, A, nb);
+        plasma_time_t stop = omp_get_wtime();
+        time += stop-start;
+        calls++;
+    } while (test_kernel_repeat(param, calls, time));
+    time /= calls;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_zpotrf(nb) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        int lapinfo = LAPACKE_zpotrf(LAPACK_COL_MAJOR,
+                                     lapack_const(uplo), nb,
+                                     Aref, nb);
+        if (lapinfo == 0 && coreinfo == 0) {
+            plasma_complex64_t zmone = -1.0;
+            cblas_zaxpy(size, CBLAS_SADDR(zmone), Aref, 1, A, 1);
+
+            double work[1];
+            double Anorm = LAPACKE_zlanhe_work(
+                LAPACK_COL_MAJOR, 'F', lapack_const(uplo), nb, Aref, nb, work);
+            double error = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', nb, nb, A, nb, work);
+            if (Anorm != 0)
+                error /= Anorm;
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(Aref);
+}
@@ -0,0 +1,182 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define A(i_, j_) A[(i_) + (size_t)nb*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests CORE_ZTRSM on tiles.
+ *        Times the solve with an NB-by-NB triangular tile and an NB-by-NB
+ *        right hand side tile, as in the panels of the factorizations,
+ *        e.g., --side=r --uplo=l --transa=c for Cholesky.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_core_ztrsm(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_SIDE  ].used = true;
+    param[PARAM_UPLO  ].used = true;
+    param[PARAM_TRANSA].used = true;
+    param[PARAM_DIAG  ].used = true;
+    param[PARAM_NB    ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t side = plasma_side_const(param[PARAM_SIDE].c);
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t diag = plasma_diag_const(param[PARAM_DIAG].c);
+
+    int nb = param[PARAM_NB].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t size = (size_t)nb*nb;
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    plasma_complex64_t *B =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    plasma_complex64_t *Bref =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(Bref != NULL);
+
+    int *ipiv = (int*)malloc((size_t)nb*sizeof(int));
+    assert(ipiv != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+
+    // Well-conditioned triangular tiles from LU, as in test_ztrsm.c.
+    retval = LAPACKE_zlarnv(1, seed, size, A);
+    assert(retval == 0);
+
+    LAPACKE_zgetrf(CblasColMajor, nb, nb, A, nb, ipiv);
+
+    if (diag == PlasmaUnit && uplo == PlasmaUpper) {
+        // U = L^T
+        for (int j = 0; j < nb; j++) {
+            for (int i = 0; i < j; i++) {
+                A(i,j) = A(j,i);
+            }
+        }
+    }
+    else if (diag == PlasmaNonUnit && uplo == PlasmaLower) {
+        // L = U^T
+        for (int j = 0; j < nb; j++) {
+            for (int i = 0; i < j; i++) {
+                A(j,i) = A(i,j);
+            }
+        }
+    }
+
+    retval = LAPACKE_zlarnv(1, seed, size, Bref);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time the kernel, restoring B before each call.
+    //================================================================
+    plasma_complex64_t zone  =  1.0;
+    plasma_complex64_t zmone = -1.0;
+
+    plasma_time_t time = 0.0;
+    int calls = 0;
+    do {
+        memcpy(B, Bref, size*sizeof(plasma_complex64_t));
+        test_flush_cache(param);
+        plasma_time_t start = omp_get_wtime();
+        core_ztrsm(side, uplo,
+                   transa, diag,
+                   nb, nb,
+                   zone, A, nb,
+                         B, nb);
+        plasma_time_t stop = omp_get_wtime();
+        time += stop-start;
+        calls++;
+    } while (test_kernel_repeat(param, calls, time));
+    time /= calls;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_ztrsm(side, nb, nb) / time / 1e9;
+
+    //================================================================
+    // Test results by checking the residual
+    // ||B - A*X|| / (||A||*||X||)
+    //================================================================
+    if (test) {
+        double work[1];
+
+        // see comments in test_ztrsm.c
+        char normc = 'F';
+        char uploc = lapack_const(uplo);
+        char diagc = lapack_const(diag);
+        double Anorm = LAPACK_zlantr(&normc, &uploc, &diagc,
+                                     &nb, &nb, A, &nb, work);
+        double Xnorm = LAPACKE_zlange_work(
+                           LAPACK_COL_MAJOR, 'F', nb, nb, B, nb, work);
+
+        // B = A*X
+        cblas_ztrmm(
+            CblasColMajor,
+            (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+            (CBLAS_TRANSPOSE)transa, (CBLAS_DIAG)diag,
+            nb, nb,
+            CBLAS_SADDR(zone), A, nb,
+            B, nb);
+
+        cblas_zaxpy(size, CBLAS_SADDR(zmone), Bref, 1, B, 1);
+
+        double error = LAPACKE_zlange_work(
+                           LAPACK_COL_MAJOR, 'F', nb, nb, B, nb, work);
+        if (Anorm * Xnorm != 0)
+            error /= (Anorm * Xnorm);
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(B);
+    free(Bref);
+    free(ipiv);
+}
@@ -0,0 +1,171 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @brief Tests CORE_ZTSMQR on tiles.
+ *        Times the application of Q^H from CORE_ZTSQRT of two NB-by-NB tiles,
+ *        with inner blocking IB, to a pair of NB-by-NB tiles, as in the
+ *        trailing updates of plasma_pzgeqrf().
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_core_ztsmqr(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_NB].used = true;
+    param[PARAM_IB].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int nb = param[PARAM_NB].i;
+    int ib = param[PARAM_IB].i;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    size_t size = (size_t)nb*nb;
+    plasma_complex64_t *A1 =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(A1 != NULL);
+
+    plasma_complex64_t *V =
+        (plasma_complex64_t*)malloc(size*sizeof(plasma_complex64_t));
+    assert(V != NULL);
+
+    plasma_complex64_t *T =
+        (plasma_complex64_t*)malloc((size_t)ib*nb*sizeof(plasma_complex64_t));
+    assert(T != NULL);
+
+    plasma_complex64_t *B =
+        (plasma_complex64_t*)malloc(2*size*sizeof(plasma_complex64_t));
+    assert(B != NULL);
+
+    plasma_complex64_t *Bref =
+        (plasma_complex64_t*)malloc(2*size*sizeof(plasma_complex64_t));
+    assert(Bref != NULL);
+
+    plasma_complex64_t *tau =
+        (plasma_complex64_t*)malloc((size_t)nb*sizeof(plasma_complex64_t));
+    assert(tau != NULL);
+
+    plasma_complex64_t *work =
+        (plasma_complex64_t*)malloc((size_t)ib*nb*sizeof(plasma_complex64_t));
+    assert(work != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, size, A1);
+    assert(retval == 0);
+
+    retval = LAPACKE_zlarnv(1, seed, size, V);
+    assert(retval == 0);
+
+    // Generate the reflectors V and T of the tile pair [A1; V].
+    core_ztsqrt(nb, nb, ib, A1, nb, V, nb, T, ib, tau, work);
+
+    // The pair updated, B1 on top of B2.
+    retval = LAPACKE_zlarnv(1, seed, 2*size, Bref);
+    assert(retval == 0);
+
+    plasma_complex64_t *B1 = B;
+    plasma_complex64_t *B2 = B + size;
+
+    //================================================================
+    // Run and time the kernel, restoring B before each call.
+    //================================================================
+    plasma_time_t time = 0.0;
+    int calls = 0;
+    do {
+        memcpy(B, Bref, 2*size*sizeof(plasma_complex64_t));
+        test_flush_cache(param);
+        plasma_time_t start = omp_get_wtime();
+        core_ztsmqr(PlasmaLeft, Plasma_ConjTrans,
+                    nb, nb, nb, nb, nb, ib,
+                    B1, nb,
+                    B2, nb,
+                    V,  nb,
+                    T,  ib,
+                    work, ib);
+        plasma_time_t stop = omp_get_wtime();
+        time += stop-start;
+        calls++;
+    } while (test_kernel_repeat(param, calls, time));
+    time /= calls;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_ztsmqr(nb, nb, nb) / time / 1e9;
+
+    //================================================================
+    // Test results by applying Q back, which recovers B if Q is
+    // unitary.
+    //================================================================
+    if (test) {
+        core_ztsmqr(PlasmaLeft, PlasmaNoTrans,
+                    nb, nb, nb, nb, nb, ib,
+                    B1, nb,
+                    B2, nb,
+                    V,  nb,
+                    T,  ib,
+                    work, ib);
+
+        double rwork[1];
+        double Bnorm = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, 2*nb, Bref, nb, rwork);
+
+        plasma_complex64_t zmone = -1.0;
+        cblas_zaxpy(2*size, CBLAS_SADDR(zmone), Bref, 1, B, 1);
+
+        double error = LAPACKE_zlange_work(
+            LAPACK_COL_MAJOR, 'F', nb, 2*nb, B, nb, rwork);
+        if (Bnorm != 0)
+            error /= Bnorm;
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A1);
+    free(V);
+    free(T);
+    free(B);
+    free(Bref);
+    free(tau);
+    free(work);
+}
@@ -95,6 +95,7 @@ void test_dzamax(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_dzamax(colrow, m, n, A, lda, values);
     plasma_time_t stop = omp_get_wtime();
@@ -0,0 +1,208 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+// The flops of the kernels are counted from their leading terms.
+static const double FlopsTolerance = 0.05;
+
+/******************************************************************************/
+// Returns the counters of the named kernel, or NULL if not counted.
+static const plasma_kernel_stats_t *stats_kernel(const plasma_stats_t *stats,
+                                                 const char *name)
+{
+    for (int i = 0; i < stats->num_kernels; i++)
+        if (strcmp(stats->kernels[i].name, name) == 0)
+            return &stats->kernels[i];
+    return NULL;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Tests the statistics of the sequences.
+ *        Solves one system by DPOSV and one by DGESV with PlasmaStats
+ *        enabled, and checks the number of sequences, the tasks of the
+ *        Cholesky and LU panels, the times, and the flops against those
+ *        of the routines. Error is the relative error of the flops.
+ *        With --inplace=y, the translations are in place, and with
+ *        --async, the solves are async calls.
+ *        Then checks that plasma_reset_stats() clears the statistics,
+ *        and that calls are not counted once PlasmaStats is disabled.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_stats(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM    ].used = PARAM_USE_N;
+    param[PARAM_NRHS   ].used = true;
+    param[PARAM_NB     ].used = true;
+    param[PARAM_IB     ].used = true;
+    param[PARAM_MTPF   ].used = true;
+    param[PARAM_INPLACE].used = true;
+    param[PARAM_ASYNC  ].used = true;
+    param[PARAM_GFLOPS ].used = false;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int n = param[PARAM_DIM].dim.n;
+    int nrhs = param[PARAM_NRHS].i;
+    int nb = param[PARAM_NB].i;
+    int async = param[PARAM_ASYNC].i;
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaNb, nb);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    plasma_set(PlasmaInplaceOutplace,
+               param[PARAM_INPLACE].c == 'y' ? PlasmaInplace : PlasmaOutplace);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    double *A = (double*)malloc((size_t)n*n*sizeof(double));
+    assert(A != NULL);
+
+    double *B = (double*)malloc((size_t)n*nrhs*sizeof(double));
+    assert(B != NULL);
+
+    int *ipiv = (int*)malloc((size_t)n*sizeof(int));
+    assert(ipiv != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_dlarnv(1, seed, (size_t)n*n, A);
+    assert(retval == 0);
+
+    // Make A symmetric positive definite, which DGESV solves as well.
+    for (int i = 0; i < n; i++) {
+        A[i+(size_t)n*i] += n;
+        for (int j = 0; j < i; j++)
+            A[j+(size_t)n*i] = A[i+(size_t)n*j];
+    }
+    double *Aref = (double*)malloc((size_t)n*n*sizeof(double));
+    assert(Aref != NULL);
+    memcpy(Aref, A, (size_t)n*n*sizeof(double));
+
+    //================================================================
+    // Run and time the solves.
+    //================================================================
+    plasma_set(PlasmaStats, PlasmaEnabled);
+    plasma_reset_stats();
+
+    retval = LAPACKE_dlarnv(1, seed, (size_t)n*nrhs, B);
+    assert(retval == 0);
+
+    plasma_time_t start = omp_get_wtime();
+    if (async == 0) {
+        plasma_dposv(PlasmaLower, n, nrhs, A, n, B, n);
+        plasma_dgesv(n, nrhs, Aref, n, ipiv, B, n);
+    }
+    else {
+        // The tasks run in the team of the async runtime.
+        plasma_sequence_t *sequence = NULL;
+        plasma_sequence_create(&sequence);
+        plasma_dposv_async(PlasmaLower, n, nrhs, A, n, B, n, sequence);
+        plasma_sequence_wait(sequence);
+        plasma_sequence_destroy(sequence);
+
+        plasma_sequence_create(&sequence);
+        plasma_dgesv_async(n, nrhs, Aref, n, ipiv, B, n, sequence);
+        plasma_sequence_wait(sequence);
+        plasma_sequence_destroy(sequence);
+    }
+    plasma_time_t stop = omp_get_wtime();
+    param[PARAM_TIME].d = stop-start;
+
+    plasma_stats_t *stats = (plasma_stats_t*)malloc(sizeof(plasma_stats_t));
+    assert(stats != NULL);
+    plasma_get_stats(stats);
+
+    //================================================================
+    // Test the statistics.
+    //================================================================
+    int nt = (n+nb-1)/nb;
+    int success = stats->num_sequences == 2;
+    success &= stats->time > 0.0 && stats->time <= stop-start;
+
+    // Each diagonal tile is factored once, and each LU panel by all of its
+    // threads.
+    const plasma_kernel_stats_t *potrf =
+        stats_kernel(stats, "core_omp_dpotrf");
+    const plasma_kernel_stats_t *getrf =
+        stats_kernel(stats, "core_omp_dgetrf");
+    success &= potrf != NULL && potrf->num_tasks == nt;
+    success &= getrf != NULL && getrf->num_tasks >= nt;
+
+    // Kernel times add up to at most the time of the threads,
+    // and the translations are among them.
+    double kernel_time = 0.0;
+    for (int i = 0; i < stats->num_kernels; i++) {
+        success &= stats->kernels[i].num_tasks > 0;
+        success &= stats->kernels[i].time >= 0.0;
+        kernel_time += stats->kernels[i].time;
+    }
+    success &= stats->num_threads > 0;
+    for (int t = 0; t < stats->num_threads; t++)
+        success &= stats->idle_time[t] >= 0.0 &&
+                   stats->idle_time[t] <= stats->time;
+    success &= kernel_time <= stats->num_threads*stats->time;
+    success &= stats->translation_time > 0.0 &&
+               stats->translation_time <= kernel_time;
+    success &= stats->barrier_time >= 0.0;
+
+    double flops = flops_dpotrf(n) + flops_dpotrs(n, nrhs) +
+                   flops_dgetrf(n, n) + flops_dgetrs(n, nrhs);
+    double error = fabs(stats->flops-flops) / flops;
+    param[PARAM_ERROR].d = error;
+    success &= error < FlopsTolerance;
+
+    // Reset, then check that nothing is counted once disabled.
+    plasma_reset_stats();
+    plasma_get_stats(stats);
+    success &= stats->num_sequences == 0 && stats->num_kernels == 0 &&
+               stats->flops == 0.0;
+
+    plasma_set(PlasmaStats, PlasmaDisabled);
+    plasma_dposv(PlasmaLower, n, nrhs, A, n, B, n);
+    plasma_get_stats(stats);
+    success &= stats->num_sequences == 0;
+
+    param[PARAM_SUCCESS].i = success;
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(Aref);
+    free(B);
+    free(ipiv);
+    free(stats);
+}
@@ -0,0 +1,152 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#include "test.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <omp.h>
+
+/******************************************************************************/
+// Creates the tasks of plasma_pzgemm() for C = A*B, with the same tile
+// lookups and dependencies, but with empty bodies.
+static void tasks_gemm(plasma_desc_t A, plasma_desc_t B, plasma_desc_t C)
+{
+    for (int m = 0; m < C.mt; m++) {
+        int ldam = plasma_tile_mmain(A, m);
+        int ldcm = plasma_tile_mmain(C, m);
+        for (int n = 0; n < C.nt; n++) {
+            for (int k = 0; k < A.nt; k++) {
+                int ldbk = plasma_tile_mmain(B, k);
+                double *a = (double*)plasma_tile_addr(A, m, k);
+                double *b = (double*)plasma_tile_addr(B, k, n);
+                double *c = (double*)plasma_tile_addr(C, m, n);
+                #pragma omp task depend(in:a[0:1]) \
+                                 depend(in:b[0:1]) \
+                                 depend(inout:c[0:1])
+                {
+                    (void)a;
+                    (void)b;
+                    (void)c;
+                    (void)ldam;
+                    (void)ldbk;
+                    (void)ldcm;
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Checks the tile lookups of A against the addressing without a table.
+static int tasks_check(plasma_desc_t A)
+{
+    plasma_desc_t B = A;
+    B.tiles = NULL;
+
+    int success = 1;
+    for (int n = 0; n < A.nt; n++) {
+        for (int m = 0; m < A.mt; m++) {
+            success &= plasma_tile_addr(A, m, n) == plasma_tile_addr(B, m, n);
+            success &= plasma_tile_mmain(A, m) == plasma_tile_mmain(B, m);
+        }
+    }
+    return success;
+}
+
+/***************************************************************************//**
+ *
+ * @brief Times the creation of the tasks of DGEMM.
+ *        Creates the tasks of C = A*B for the tiles of A, B and C with the
+ *        tile lookups and dependencies of plasma_pzgemm(), but with empty
+ *        bodies, so that time is dominated by task creation. There are
+ *        mt*nt*kt tasks, e.g., 262144 for --dim=8192 --nb=64.
+ *        The matrices are not touched, so they take no physical memory.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_tasks(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM   ].used = PARAM_USE_M | PARAM_USE_N | PARAM_USE_K;
+    param[PARAM_NB    ].used = true;
+    param[PARAM_TABLE ].used = true;
+    param[PARAM_ERROR ].used = false;
+    param[PARAM_GFLOPS].used = false;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int m = param[PARAM_DIM].dim.m;
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+    int nb = param[PARAM_NB].i;
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaTileTable,
+               param[PARAM_TABLE].c == 'y' ? PlasmaEnabled : PlasmaDisabled);
+
+    //================================================================
+    // Create descriptors.
+    //================================================================
+    plasma_desc_t A;
+    plasma_desc_t B;
+    plasma_desc_t C;
+    int retval;
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m, k, 0, 0, m, k, &A);
+    assert(retval == PlasmaSuccess);
+
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        k, n, 0, 0, k, n, &B);
+    assert(retval == PlasmaSuccess);
+
+    retval = plasma_desc_general_create(PlasmaRealDouble, nb, nb,
+                                        m, n, 0, 0, m, n, &C);
+    assert(retval == PlasmaSuccess);
+
+    //================================================================
+    // Run and time the task creation.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    #pragma omp parallel
+    #pragma omp master
+    {
+        tasks_gemm(A, B, C);
+    }
+    plasma_time_t stop = omp_get_wtime();
+    param[PARAM_TIME].d = stop-start;
+
+    //================================================================
+    // Test the tile lookups of the matrix and of a view.
+    //================================================================
+    int success = tasks_check(C);
+    if (m > nb && n > nb)
+        success &= tasks_check(plasma_desc_view(C, nb, nb, m-nb, n-nb));
+    param[PARAM_SUCCESS].i = success;
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&B);
+    plasma_desc_destroy(&C);
+}
@@ -17,6 +17,14 @@
 //==============================================================================
 // test routines
 //==============================================================================
+void test_core_zgemm(param_value_t param[], bool run);
+void test_core_zgeqrt(param_value_t param[], bool run);
+void test_core_zgetrf(param_value_t param[], bool run);
+void test_core_zherk(param_value_t param[], bool run);
+void test_core_zpotrf(param_value_t param[], bool run);
+void test_core_ztrsm(param_value_t param[], bool run);
+void test_core_ztsmqr(param_value_t param[], bool run);
+void test_core_zttmqr(param_value_t param[], bool run);
 void test_dzamax(param_value_t param[], bool run);
 void test_zgbsv(param_value_t param[], bool run);
 void test_zgbtrf(param_value_t param[], bool run);
@@ -25,13 +33,16 @@ void test_zgelqf(param_value_t param[], bool run);
 void test_zgelqs(param_value_t param[], bool run);
 void test_zgels(param_value_t param[], bool run);
 void test_zgemm(param_value_t param[], bool run);
+void test_zgemm_batch(param_value_t param[], bool run);
 void test_zgeqrf(param_value_t param[], bool run);
 void test_zgeqrs(param_value_t param[], bool run);
 void test_zgesv(param_value_t param[], bool run);
 void test_zgetrf(param_value_t param[], bool run);
+void test_zgetrf_batch(param_value_t param[], bool run);
 void test_zgetri(param_value_t param[], bool run);
 void test_zgetri_aux(param_value_t param[], bool run);
 void test_zgetrs(param_value_t param[], bool run);
+void test_zgetrs_batch(param_value_t param[], bool run);
 void test_zhemm(param_value_t param[], bool run);
 void test_zher2k(param_value_t param[], bool run);
 void test_zherk(param_value_t param[], bool run);
@@ -51,6 +62,7 @@ void test_zpbsv(param_value_t param[], bool run);
 void test_zpbtrf(param_value_t param[], bool run);
 void test_zposv(param_value_t param[], bool run);
 void test_zpotrf(param_value_t param[], bool run);
+void test_zpotrf_batch(param_value_t param[], bool run);
 void test_zpotri(param_value_t param[], bool run);
 void test_zpotrs(param_value_t param[], bool run);
 void test_zsymm(param_value_t param[], bool run);
@@ -114,6 +114,7 @@ void test_zcgesv(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zcgesv(n, nrhs, A, lda, ipiv, B, ldb, X, ldx, &ITER);
     plasma_time_t stop = omp_get_wtime();
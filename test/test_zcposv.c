@@ -125,6 +125,7 @@ void test_zcposv(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zcposv(uplo, n, nrhs, A, lda, B, ldb, X, ldx, &ITER);
     plasma_time_t stop = omp_get_wtime();
@@ -157,6 +157,7 @@ void test_zgbsv(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zgbsv(n, kl, ku, nrhs, AB, ldab, ipiv, X, ldx);
 
@@ -50,6 +50,7 @@ void test_zgbtrf(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     param[PARAM_ZEROCOL].used = true;
     if (! run)
         return;
@@ -75,6 +76,7 @@ void test_zgbtrf(param_value_t param[], bool run)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -140,6 +142,7 @@ void test_zgbtrf(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zgbtrf(m, n, kl, ku, AB, ldab, ipiv);
 
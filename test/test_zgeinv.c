@@ -102,6 +102,7 @@ void test_zgeinv(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zgeinv(n, n, A, lda, ipiv);
     plasma_time_t stop = omp_get_wtime();
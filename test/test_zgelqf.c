@@ -99,6 +99,7 @@ void test_zgelqf(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zgelqf(m, n, A, lda, &T);
     plasma_time_t stop = omp_get_wtime();
@@ -124,6 +124,7 @@ void test_zgelqs(param_value_t param[], bool run)
     plasma_zgelqf(m, n, A, lda, &T);
 
     // perform solution of the system by the prepared LQ factorization of A
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zgelqs(m, n, nrhs,
                   A, lda,
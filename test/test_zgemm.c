@@ -49,6 +49,10 @@ void test_zgemm(param_value_t param[], bool run)
     param[PARAM_PADB   ].used = true;
     param[PARAM_PADC   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_PLACEMENT].used = true;
+    param[PARAM_AFFINITY ].used = true;
+    param[PARAM_HUGE     ].used = true;
+    param[PARAM_INPLACE  ].used = true;
     if (! run)
         return;
 
@@ -104,6 +108,15 @@ void test_zgemm(param_value_t param[], bool run)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaTilePlacement,
+               placement_const(param[PARAM_PLACEMENT].c));
+    plasma_set(PlasmaTaskAffinity,
+               param[PARAM_AFFINITY].c == 'y' ? PlasmaEnabled
+                                              : PlasmaDisabled);
+    plasma_set(PlasmaHugePages,
+               param[PARAM_HUGE].c == 'y' ? PlasmaEnabled : PlasmaDisabled);
+    plasma_set(PlasmaInplaceOutplace,
+               param[PARAM_INPLACE].c == 'y' ? PlasmaInplace : PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -143,6 +156,7 @@ void test_zgemm(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     plasma_zgemm(
@@ -0,0 +1,258 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZGEMM_BATCH.
+ *        Multiplies --batch matrices of size --dim, or with --vary=y, of
+ *        sizes up to --dim, with plasma_zgemm_vbatch. Gflop/s is for the
+ *        whole batch, and the error is the largest one.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgemm_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_TRANSA ].used = true;
+    param[PARAM_TRANSB ].used = true;
+    param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N | PARAM_USE_K;
+    param[PARAM_ALPHA  ].used = true;
+    param[PARAM_BETA   ].used = true;
+    param[PARAM_PADA   ].used = true;
+    param[PARAM_PADB   ].used = true;
+    param[PARAM_PADC   ].used = true;
+    param[PARAM_BATCH  ].used = true;
+    param[PARAM_VARY   ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t transa = plasma_trans_const(param[PARAM_TRANSA].c);
+    plasma_enum_t transb = plasma_trans_const(param[PARAM_TRANSB].c);
+
+    int batch = param[PARAM_BATCH].i;
+    char vary = param[PARAM_VARY].c;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double eps = LAPACKE_dlamch('E');
+
+#ifdef COMPLEX
+    plasma_complex64_t alpha = param[PARAM_ALPHA].z;
+    plasma_complex64_t beta  = param[PARAM_BETA].z;
+#else
+    double alpha = creal(param[PARAM_ALPHA].z);
+    double beta  = creal(param[PARAM_BETA].z);
+#endif
+
+    //================================================================
+    // Set sizes of the problems.
+    //================================================================
+    int *m = (int*)malloc((size_t)batch*sizeof(int));
+    assert(m != NULL);
+
+    int *n = (int*)malloc((size_t)batch*sizeof(int));
+    assert(n != NULL);
+
+    int *k = (int*)malloc((size_t)batch*sizeof(int));
+    assert(k != NULL);
+
+    int *lda = (int*)malloc((size_t)batch*sizeof(int));
+    assert(lda != NULL);
+
+    int *ldb = (int*)malloc((size_t)batch*sizeof(int));
+    assert(ldb != NULL);
+
+    int *ldc = (int*)malloc((size_t)batch*sizeof(int));
+    assert(ldc != NULL);
+
+    size_t *offset = (size_t*)malloc((size_t)(batch+1)*sizeof(size_t));
+    assert(offset != NULL);
+
+    // Each problem takes its A, B and C in turn from one array.
+    double flops = 0.0;
+    offset[0] = 0;
+    for (int i = 0; i < batch; i++) {
+        m[i] = batch_size(param[PARAM_DIM].dim.m, 3*i, vary);
+        n[i] = batch_size(param[PARAM_DIM].dim.n, 3*i+1, vary);
+        k[i] = batch_size(param[PARAM_DIM].dim.k, 3*i+2, vary);
+        int Am = transa == PlasmaNoTrans ? m[i] : k[i];
+        int An = transa == PlasmaNoTrans ? k[i] : m[i];
+        int Bm = transb == PlasmaNoTrans ? k[i] : n[i];
+        int Bn = transb == PlasmaNoTrans ? n[i] : k[i];
+        lda[i] = imax(1, Am + param[PARAM_PADA].i);
+        ldb[i] = imax(1, Bm + param[PARAM_PADB].i);
+        ldc[i] = imax(1, m[i] + param[PARAM_PADC].i);
+        offset[i+1] = offset[i] + (size_t)lda[i]*An
+                                + (size_t)ldb[i]*Bn
+                                + (size_t)ldc[i]*n[i];
+        flops += flops_zgemm(m[i], n[i], k[i]);
+    }
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *ABC =
+        (plasma_complex64_t*)malloc(offset[batch]*sizeof(plasma_complex64_t));
+    assert(ABC != NULL);
+
+    plasma_complex64_t **pA =
+        (plasma_complex64_t**)malloc((size_t)batch*sizeof(plasma_complex64_t*));
+    assert(pA != NULL);
+
+    plasma_complex64_t **pB =
+        (plasma_complex64_t**)malloc((size_t)batch*sizeof(plasma_complex64_t*));
+    assert(pB != NULL);
+
+    plasma_complex64_t **pC =
+        (plasma_complex64_t**)malloc((size_t)batch*sizeof(plasma_complex64_t*));
+    assert(pC != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, offset[batch], ABC);
+    assert(retval == 0);
+
+    for (int i = 0; i < batch; i++) {
+        int An = transa == PlasmaNoTrans ? k[i] : m[i];
+        int Bn = transb == PlasmaNoTrans ? n[i] : k[i];
+        pA[i] = &ABC[offset[i]];
+        pB[i] = pA[i] + (size_t)lda[i]*An;
+        pC[i] = pB[i] + (size_t)ldb[i]*Bn;
+    }
+
+    plasma_complex64_t *ABCref = NULL;
+    if (test) {
+        ABCref = (plasma_complex64_t*)malloc(
+            offset[batch]*sizeof(plasma_complex64_t));
+        assert(ABCref != NULL);
+
+        memcpy(ABCref, ABC, offset[batch]*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    test_flush_cache(param);
+    plasma_time_t start = omp_get_wtime();
+    int plainfo;
+    if (vary == 'y') {
+        plainfo = plasma_zgemm_vbatch(transa, transb,
+                                      m, n, k,
+                                      alpha, pA, lda,
+                                             pB, ldb,
+                                       beta, pC, ldc,
+                                      batch);
+    }
+    else {
+        plainfo = plasma_zgemm_batch(transa, transb,
+                                     param[PARAM_DIM].dim.m,
+                                     param[PARAM_DIM].dim.n,
+                                     param[PARAM_DIM].dim.k,
+                                     alpha, pA, batch > 0 ? lda[0] : 1,
+                                            pB, batch > 0 ? ldb[0] : 1,
+                                      beta, pC, batch > 0 ? ldc[0] : 1,
+                                     batch);
+    }
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation,
+    // with the bound of test_zgemm for each problem.
+    //================================================================
+    if (test) {
+        double error = plainfo == PlasmaSuccess ? 0.0 : INFINITY;
+        for (int i = 0; i < batch; i++) {
+            int Am = transa == PlasmaNoTrans ? m[i] : k[i];
+            int An = transa == PlasmaNoTrans ? k[i] : m[i];
+            int Bm = transb == PlasmaNoTrans ? k[i] : n[i];
+            int Bn = transb == PlasmaNoTrans ? n[i] : k[i];
+            plasma_complex64_t *A = &ABCref[offset[i]];
+            plasma_complex64_t *B = A + (size_t)lda[i]*An;
+            plasma_complex64_t *Cref = B + (size_t)ldb[i]*Bn;
+
+            double work[1];
+            double Anorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', Am, An, A, lda[i], work);
+            double Bnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', Bm, Bn, B, ldb[i], work);
+            double Cnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', m[i], n[i], Cref, ldc[i], work);
+
+            cblas_zgemm(
+                CblasColMajor,
+                (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                m[i], n[i], k[i],
+                CBLAS_SADDR(alpha), A, lda[i],
+                                    B, ldb[i],
+                 CBLAS_SADDR(beta), Cref, ldc[i]);
+
+            plasma_complex64_t zmone = -1.0;
+            cblas_zaxpy((size_t)ldc[i]*n[i], CBLAS_SADDR(zmone),
+                        Cref, 1, pC[i], 1);
+
+            double err = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'F', m[i], n[i], pC[i], ldc[i], work);
+            double normalize = sqrt((double)k[i]+2) * cabs(alpha) * Anorm * Bnorm
+                             + 2 * cabs(beta) * Cnorm;
+            if (normalize != 0)
+                err /= normalize;
+
+            error = fmax(error, err);
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < 3*eps;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(m);
+    free(n);
+    free(k);
+    free(lda);
+    free(ldb);
+    free(ldc);
+    free(offset);
+    free(ABC);
+    free(pA);
+    free(pB);
+    free(pC);
+    if (test)
+        free(ABCref);
+}
@@ -44,6 +44,7 @@ void test_zgeqrf(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_HMODE  ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     if (! run)
         return;
 
@@ -63,6 +64,7 @@ void test_zgeqrf(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
     if (param[PARAM_HMODE].c == 't') {
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     }
@@ -99,6 +101,7 @@ void test_zgeqrf(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zgeqrf(m, n, A, lda, &T);
     plasma_time_t stop = omp_get_wtime();
@@ -124,6 +124,7 @@ void test_zgeqrs(param_value_t param[], bool run)
     plasma_zgeqrf(m, n, A, lda, &T);
 
     // perform solution of the system by the prepared QR factorization of A
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zgeqrs(m, n, nrhs,
                   A, lda,
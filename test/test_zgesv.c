@@ -16,6 +16,7 @@
 #include "plasma.h"
 
 #include <assert.h>
+#include <math.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -49,6 +50,9 @@ void test_zgesv(param_value_t param[], bool run)
     param[PARAM_NB     ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
+    param[PARAM_INPLACE].used = true;
+    param[PARAM_ASYNC  ].used = true;
+    param[PARAM_CANCEL ].used = true;
     if (! run)
         return;
 
@@ -61,6 +65,15 @@ void test_zgesv(param_value_t param[], bool run)
     int lda = imax(1, n+param[PARAM_PADA].i);
     int ldb = imax(1, n+param[PARAM_PADB].i);
 
+    // With --async, that many copies of the system are solved at once.
+    int async = param[PARAM_ASYNC].i;
+    int copies = imax(1, async);
+    size_t sizeA = (size_t)lda*n;
+    size_t sizeB = (size_t)ldb*nrhs;
+
+    // With --cancel, the copies are solved again, canceled at once.
+    int cancel = async > 0 && param[PARAM_CANCEL].c == 'y';
+
     int test = param[PARAM_TEST].c == 'y';
     double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
 
@@ -70,20 +83,21 @@ void test_zgesv(param_value_t param[], bool run)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    plasma_set(PlasmaInplaceOutplace,
+               param[PARAM_INPLACE].c == 'y' ? PlasmaInplace : PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
     //================================================================
     plasma_complex64_t *A =
-        (plasma_complex64_t*)malloc((size_t)lda*n*sizeof(plasma_complex64_t));
+        (plasma_complex64_t*)malloc(copies*sizeA*sizeof(plasma_complex64_t));
     assert(A != NULL);
 
     plasma_complex64_t *B =
-        (plasma_complex64_t*)malloc(
-            (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+        (plasma_complex64_t*)malloc(copies*sizeB*sizeof(plasma_complex64_t));
     assert(B != NULL);
 
-    int *ipiv = (int*)malloc((size_t)n*sizeof(int));
+    int *ipiv = (int*)malloc((size_t)copies*n*sizeof(int));
     assert(ipiv != NULL);
 
     int seed[] = {0, 0, 0, 1};
@@ -94,6 +108,24 @@ void test_zgesv(param_value_t param[], bool run)
     retval = LAPACKE_zlarnv(1, seed, (size_t)ldb*nrhs, B);
     assert(retval == 0);
 
+    for (int i = 1; i < copies; i++) {
+        memcpy(&A[i*sizeA], A, sizeA*sizeof(plasma_complex64_t));
+        memcpy(&B[i*sizeB], B, sizeB*sizeof(plasma_complex64_t));
+    }
+
+    plasma_complex64_t *Ain = NULL;
+    plasma_complex64_t *Bin = NULL;
+    if (cancel) {
+        Ain = (plasma_complex64_t*)malloc(sizeA*sizeof(plasma_complex64_t));
+        assert(Ain != NULL);
+
+        Bin = (plasma_complex64_t*)malloc(sizeB*sizeof(plasma_complex64_t));
+        assert(Bin != NULL);
+
+        memcpy(Ain, A, sizeA*sizeof(plasma_complex64_t));
+        memcpy(Bin, B, sizeB*sizeof(plasma_complex64_t));
+    }
+
     plasma_complex64_t *Aref = NULL;
     plasma_complex64_t *Bref = NULL;
     double *work = NULL;
@@ -103,22 +135,34 @@ void test_zgesv(param_value_t param[], bool run)
         assert(Aref != NULL);
 
         Bref = (plasma_complex64_t*)malloc(
-            (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+            copies*sizeB*sizeof(plasma_complex64_t));
         assert(Bref != NULL);
 
         memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
-        memcpy(Bref, B, (size_t)ldb*nrhs*sizeof(plasma_complex64_t));
+        memcpy(Bref, B, copies*sizeB*sizeof(plasma_complex64_t));
     }
 
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
-    plasma_zgesv(n, nrhs, A, lda, ipiv, B, ldb);
+    if (async == 0) {
+        plasma_zgesv(n, nrhs, A, lda, ipiv, B, ldb);
+    }
+    else {
+        plasma_sequence_t *sequence = NULL;
+        plasma_sequence_create(&sequence);
+        for (int i = 0; i < copies; i++)
+            plasma_zgesv_async(n, nrhs, &A[i*sizeA], lda, &ipiv[(size_t)i*n],
+                                        &B[i*sizeB], ldb, sequence);
+        plasma_sequence_wait(sequence);
+        plasma_sequence_destroy(sequence);
+    }
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
 
-    double flops = flops_zgetrf(n, n) + flops_zgetrs(n, nrhs);
+    double flops = copies*(flops_zgetrf(n, n) + flops_zgetrs(n, nrhs));
     param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops / time / 1e9;
 
@@ -129,6 +173,7 @@ void test_zgesv(param_value_t param[], bool run)
     //                --------------------------- < epsilon
     //                 || A ||_I * || X ||_I * N
     //
+    // With --async, the largest residual of the copies.
     //================================================================
     if (test) {
         plasma_complex64_t zone  =  1.0;
@@ -139,29 +184,62 @@ void test_zgesv(param_value_t param[], bool run)
 
         double Anorm = LAPACKE_zlange_work(
             LAPACK_COL_MAJOR, 'I', n, n, Aref, lda, work);
-        double Xnorm = LAPACKE_zlange_work(
-            LAPACK_COL_MAJOR, 'I', n, nrhs, B, ldb, work);
 
-        // Bref -= Aref*B
-        cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, nrhs, n,
-                    CBLAS_SADDR(zmone), Aref, lda,
-                                        B,    ldb,
-                    CBLAS_SADDR(zone),  Bref, ldb);
+        double residual = 0.0;
+        for (int i = 0; i < copies; i++) {
+            double Xnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, &B[i*sizeB], ldb, work);
 
-        double Rnorm = LAPACKE_zlange_work(
-            LAPACK_COL_MAJOR, 'I', n, nrhs, Bref, ldb, work);
-        double residual = Rnorm/(n*Anorm*Xnorm);
+            // Bref -= Aref*B
+            cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, nrhs, n,
+                        CBLAS_SADDR(zmone), Aref,           lda,
+                                            &B[i*sizeB],    ldb,
+                        CBLAS_SADDR(zone),  &Bref[i*sizeB], ldb);
+
+            double Rnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'I', n, nrhs, &Bref[i*sizeB], ldb, work);
+            residual = fmax(residual, Rnorm/(n*Anorm*Xnorm));
+        }
 
         param[PARAM_ERROR].d = residual;
         param[PARAM_SUCCESS].i = residual < tol;
     }
 
+    //================================================================
+    // With --cancel, solve the copies again, canceling the sequence
+    // right after submitting them. The wait has to return the canceled
+    // status in less than half the time of the solve.
+    //================================================================
+    if (cancel) {
+        for (int i = 0; i < copies; i++) {
+            memcpy(&A[i*sizeA], Ain, sizeA*sizeof(plasma_complex64_t));
+            memcpy(&B[i*sizeB], Bin, sizeB*sizeof(plasma_complex64_t));
+        }
+        plasma_time_t start_cancel = omp_get_wtime();
+        plasma_sequence_t *sequence = NULL;
+        plasma_sequence_create(&sequence);
+        for (int i = 0; i < copies; i++)
+            plasma_zgesv_async(n, nrhs, &A[i*sizeA], lda, &ipiv[(size_t)i*n],
+                                        &B[i*sizeB], ldb, sequence);
+        plasma_sequence_cancel(sequence);
+        int status = plasma_sequence_wait(sequence);
+        plasma_sequence_destroy(sequence);
+        plasma_time_t time_cancel = omp_get_wtime()-start_cancel;
+
+        int canceled = status == PlasmaErrorCanceled && time_cancel < time/2;
+        param[PARAM_SUCCESS].i = param[PARAM_SUCCESS].i && canceled;
+    }
+
     //================================================================
     // Free arrays.
     //================================================================
     free(A);
     free(B);
     free(ipiv);
+    if (cancel) {
+        free(Ain);
+        free(Bin);
+    }
     if (test) {
         free(Aref);
         free(Bref);
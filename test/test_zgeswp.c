@@ -107,6 +107,7 @@ void test_zgeswp(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     retval = plasma_zgeswp(colrow, m, n, A, lda, ipiv, incx);
     plasma_time_t stop = omp_get_wtime();
@@ -17,6 +17,8 @@
 
 #include <assert.h>
 #include <math.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -26,9 +28,71 @@
 
 #define COMPLEX
 
+typedef struct {
+    param_value_t *param;       // parameters of the test
+    volatile int *num_ready;    // number of callers ready to start
+    int num_callers;            // number of callers
+    int m, n;                   // dimensions of A
+    plasma_complex64_t *A;      // copy of A factored by the caller
+    int lda;                    // leading dimension of A
+    int *ipiv;                  // pivots of the caller
+    int info;                   // return value of plasma_zgetrf()
+    plasma_time_t start;        // start of the factorization
+    plasma_time_t stop;         // end of the factorization
+} caller_t;
+
+/******************************************************************************/
+static void getrf_set(param_value_t param[])
+{
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    plasma_set(PlasmaTilePlacement,
+               placement_const(param[PARAM_PLACEMENT].c));
+    plasma_set(PlasmaTaskAffinity,
+               param[PARAM_AFFINITY].c == 'y' ? PlasmaEnabled
+                                              : PlasmaDisabled);
+    plasma_set(PlasmaHugePages,
+               param[PARAM_HUGE].c == 'y' ? PlasmaEnabled : PlasmaDisabled);
+    plasma_set(PlasmaInplaceOutplace,
+               param[PARAM_INPLACE].c == 'y' ? PlasmaInplace : PlasmaOutplace);
+}
+
+/******************************************************************************/
+static void *getrf_caller(void *arg)
+{
+    caller_t *caller = (caller_t*)arg;
+    caller->info = -1;
+
+    // Attach a context to this thread.
+    if (plasma_init() != PlasmaSuccess) {
+        __sync_fetch_and_add(caller->num_ready, 1);
+        return NULL;
+    }
+    getrf_set(caller->param);
+
+    // Wait for all callers, so that the factorizations overlap.
+    __sync_fetch_and_add(caller->num_ready, 1);
+    while (*caller->num_ready < caller->num_callers)
+        sched_yield();
+
+    caller->start = omp_get_wtime();
+    caller->info = plasma_zgetrf(caller->m, caller->n,
+                                 caller->A, caller->lda, caller->ipiv);
+    caller->stop = omp_get_wtime();
+
+    plasma_finalize();
+    return NULL;
+}
+
 /***************************************************************************//**
  *
- * @brief Tests ZPOTRF.
+ * @brief Tests ZGETRF.
+ *        With --callers greater than one, as many application threads,
+ *        each with its own context, factor copies of A concurrently.
+ *        Time is from the first start to the last end, Gflop/s is for
+ *        all the factorizations, and the error is the largest one.
  *
  * @param[in,out] param - array of parameters
  * @param[in]     run - whether to run test
@@ -44,9 +108,15 @@ void test_zgetrf(param_value_t param[], bool run)
     param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
     param[PARAM_PADA   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_PLACEMENT].used = true;
+    param[PARAM_AFFINITY ].used = true;
+    param[PARAM_HUGE     ].used = true;
+    param[PARAM_INPLACE  ].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     param[PARAM_ZEROCOL].used = true;
+    param[PARAM_CALLERS].used = true;
     if (! run)
         return;
 
@@ -55,6 +125,8 @@ void test_zgetrf(param_value_t param[], bool run)
     //================================================================
     int m = param[PARAM_DIM].dim.m;
     int n = param[PARAM_DIM].dim.n;
+    int num_callers = param[PARAM_CALLERS].i;
+    assert(num_callers > 0);
 
     int lda = imax(1, m+param[PARAM_PADA].i);
 
@@ -64,9 +136,7 @@ void test_zgetrf(param_value_t param[], bool run)
     //================================================================
     // Set tuning parameters.
     //================================================================
-    plasma_set(PlasmaNb, param[PARAM_NB].i);
-    plasma_set(PlasmaIb, param[PARAM_IB].i);
-    plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    getrf_set(param);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -96,16 +166,67 @@ void test_zgetrf(param_value_t param[], bool run)
         memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex64_t));
     }
 
+    caller_t *callers = NULL;
+    if (num_callers > 1) {
+        callers = (caller_t*)malloc(num_callers*sizeof(caller_t));
+        assert(callers != NULL);
+
+        for (int i = 0; i < num_callers; i++) {
+            callers[i].A = (plasma_complex64_t*)malloc(
+                (size_t)lda*n*sizeof(plasma_complex64_t));
+            assert(callers[i].A != NULL);
+            memcpy(callers[i].A, A, (size_t)lda*n*sizeof(plasma_complex64_t));
+
+            callers[i].ipiv = (int*)malloc((size_t)m*sizeof(int));
+            assert(callers[i].ipiv != NULL);
+        }
+    }
+
     //================================================================
     // Run and time PLASMA.
     //================================================================
-    plasma_time_t start = omp_get_wtime();
-    int plainfo = plasma_zgetrf(m, n, A, lda, ipiv);
-    plasma_time_t stop = omp_get_wtime();
-    plasma_time_t time = stop-start;
+    int plainfo;
+    plasma_time_t time;
+    if (num_callers == 1) {
+        test_flush_cache(param);
+        plasma_time_t start = omp_get_wtime();
+        plainfo = plasma_zgetrf(m, n, A, lda, ipiv);
+        plasma_time_t stop = omp_get_wtime();
+        time = stop-start;
+    }
+    else {
+        pthread_t *threads =
+            (pthread_t*)malloc(num_callers*sizeof(pthread_t));
+        assert(threads != NULL);
+
+        volatile int num_ready = 0;
+        for (int i = 0; i < num_callers; i++) {
+            callers[i].param = param;
+            callers[i].num_ready = &num_ready;
+            callers[i].num_callers = num_callers;
+            callers[i].m = m;
+            callers[i].n = n;
+            callers[i].lda = lda;
+            retval = pthread_create(&threads[i], NULL,
+                                    getrf_caller, &callers[i]);
+            assert(retval == 0);
+        }
+        for (int i = 0; i < num_callers; i++)
+            pthread_join(threads[i], NULL);
+        free(threads);
+
+        plasma_time_t start = callers[0].start;
+        plasma_time_t stop = callers[0].stop;
+        for (int i = 1; i < num_callers; i++) {
+            start = fmin(start, callers[i].start);
+            stop = fmax(stop, callers[i].stop);
+        }
+        time = stop-start;
+        plainfo = callers[0].info;
+    }
 
     param[PARAM_TIME].d = time;
-    param[PARAM_GFLOPS].d = flops_zgetrf(m, n) / time / 1e9;
+    param[PARAM_GFLOPS].d = num_callers * flops_zgetrf(m, n) / time / 1e9;
 
     //================================================================
     // Test results by comparing to a reference implementation.
@@ -119,25 +240,39 @@ void test_zgetrf(param_value_t param[], bool run)
             Aref, lda, ipiv);
 
         if (lapinfo == 0) {
-            plasma_complex64_t zmone = -1.0;
-            cblas_zaxpy((size_t)lda*n, CBLAS_SADDR(zmone), Aref, 1, A, 1);
-
             double work[1];
             double Anorm = LAPACKE_zlange_work(
                 LAPACK_COL_MAJOR, 'F', m, n, Aref, lda, work);
 
-            double error = LAPACKE_zlange_work(
-                LAPACK_COL_MAJOR, 'F', m, n, A, lda, work);
+            double error = 0.0;
+            for (int i = 0; i < num_callers; i++) {
+                plasma_complex64_t *LU = num_callers == 1 ? A : callers[i].A;
+                int info = num_callers == 1 ? plainfo : callers[i].info;
+
+                plasma_complex64_t zmone = -1.0;
+                cblas_zaxpy((size_t)lda*n, CBLAS_SADDR(zmone), Aref, 1, LU, 1);
 
-            if (Anorm != 0.0)
-                error /= Anorm;
-            error /= sqrt((double)m*n);
+                double err = LAPACKE_zlange_work(
+                    LAPACK_COL_MAJOR, 'F', m, n, LU, lda, work);
+
+                if (Anorm != 0.0)
+                    err /= Anorm;
+                err /= sqrt((double)m*n);
+                if (info != 0)
+                    err = INFINITY;
+
+                error = fmax(error, err);
+            }
 
             param[PARAM_ERROR].d = error;
             param[PARAM_SUCCESS].i = error < tol;
         }
         else {
-            if (plainfo == lapinfo) {
+            int success = plainfo == lapinfo;
+            for (int i = 1; i < num_callers; i++)
+                success &= callers[i].info == lapinfo;
+
+            if (success) {
                 param[PARAM_ERROR].d = 0.0;
                 param[PARAM_SUCCESS].i = 1;
             }
@@ -155,4 +290,11 @@ void test_zgetrf(param_value_t param[], bool run)
     free(ipiv);
     if (test)
         free(Aref);
+    if (num_callers > 1) {
+        for (int i = 0; i < num_callers; i++) {
+            free(callers[i].A);
+            free(callers[i].ipiv);
+        }
+        free(callers);
+    }
 }
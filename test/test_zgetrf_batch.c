@@ -0,0 +1,210 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZGETRF_BATCH.
+ *        Factors --batch matrices of size --dim, or with --vary=y, of
+ *        sizes up to --dim, with plasma_zgetrf_vbatch. Gflop/s is for the
+ *        whole batch, and the error is the largest one.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgetrf_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
+    param[PARAM_PADA   ].used = true;
+    param[PARAM_BATCH  ].used = true;
+    param[PARAM_VARY   ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int batch = param[PARAM_BATCH].i;
+    char vary = param[PARAM_VARY].c;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set sizes of the problems.
+    //================================================================
+    int *m = (int*)malloc((size_t)batch*sizeof(int));
+    assert(m != NULL);
+
+    int *n = (int*)malloc((size_t)batch*sizeof(int));
+    assert(n != NULL);
+
+    int *lda = (int*)malloc((size_t)batch*sizeof(int));
+    assert(lda != NULL);
+
+    size_t *offset = (size_t*)malloc((size_t)(batch+1)*sizeof(size_t));
+    assert(offset != NULL);
+
+    size_t *ioffset = (size_t*)malloc((size_t)(batch+1)*sizeof(size_t));
+    assert(ioffset != NULL);
+
+    double flops = 0.0;
+    offset[0] = 0;
+    ioffset[0] = 0;
+    for (int i = 0; i < batch; i++) {
+        m[i] = batch_size(param[PARAM_DIM].dim.m, 2*i, vary);
+        n[i] = batch_size(param[PARAM_DIM].dim.n, 2*i+1, vary);
+        lda[i] = imax(1, m[i] + param[PARAM_PADA].i);
+        offset[i+1] = offset[i] + (size_t)lda[i]*n[i];
+        ioffset[i+1] = ioffset[i] + (size_t)imin(m[i], n[i]);
+        flops += flops_zgetrf(m[i], n[i]);
+    }
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *A =
+        (plasma_complex64_t*)malloc(offset[batch]*sizeof(plasma_complex64_t));
+    assert(A != NULL);
+
+    int *ipiv = (int*)malloc((ioffset[batch]+1)*sizeof(int));
+    assert(ipiv != NULL);
+
+    plasma_complex64_t **pA =
+        (plasma_complex64_t**)malloc((size_t)batch*sizeof(plasma_complex64_t*));
+    assert(pA != NULL);
+
+    int **pipiv = (int**)malloc((size_t)batch*sizeof(int*));
+    assert(pipiv != NULL);
+
+    int *info = (int*)malloc((size_t)batch*sizeof(int));
+    assert(info != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, offset[batch], A);
+    assert(retval == 0);
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &A[offset[i]];
+        pipiv[i] = &ipiv[ioffset[i]];
+    }
+
+    plasma_complex64_t *Aref = NULL;
+    int *ipivref = NULL;
+    if (test) {
+        Aref = (plasma_complex64_t*)malloc(
+            offset[batch]*sizeof(plasma_complex64_t));
+        assert(Aref != NULL);
+
+        ipivref = (int*)malloc((ioffset[batch]+1)*sizeof(int));
+        assert(ipivref != NULL);
+
+        memcpy(Aref, A, offset[batch]*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    test_flush_cache(param);
+    plasma_time_t start = omp_get_wtime();
+    int plainfo;
+    if (vary == 'y')
+        plainfo = plasma_zgetrf_vbatch(m, n, pA, lda, pipiv, info, batch);
+    else
+        plainfo = plasma_zgetrf_batch(param[PARAM_DIM].dim.m,
+                                      param[PARAM_DIM].dim.n,
+                                      pA, batch > 0 ? lda[0] : 1,
+                                      pipiv, info, batch);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to a reference implementation.
+    //================================================================
+    if (test) {
+        double error = plainfo == PlasmaSuccess ? 0.0 : INFINITY;
+        for (int i = 0; i < batch; i++) {
+            if (imin(m[i], n[i]) == 0)
+                continue;
+
+            plasma_complex64_t *Ai = &A[offset[i]];
+            plasma_complex64_t *Arefi = &Aref[offset[i]];
+            int lapinfo = LAPACKE_zgetrf(LAPACK_COL_MAJOR, m[i], n[i],
+                                         Arefi, lda[i], ipivref);
+            if (info[i] != lapinfo ||
+                memcmp(pipiv[i], ipivref,
+                       imin(m[i], n[i])*sizeof(int)) != 0) {
+                error = INFINITY;
+            }
+            else {
+                plasma_complex64_t zmone = -1.0;
+                cblas_zaxpy((size_t)lda[i]*n[i], CBLAS_SADDR(zmone),
+                            Arefi, 1, Ai, 1);
+
+                double work[1];
+                double Anorm = LAPACKE_zlange_work(
+                    LAPACK_COL_MAJOR, 'F', m[i], n[i], Arefi, lda[i], work);
+                double err = LAPACKE_zlange_work(
+                    LAPACK_COL_MAJOR, 'F', m[i], n[i], Ai, lda[i], work);
+                if (Anorm != 0.0)
+                    err /= Anorm;
+                err /= sqrt((double)m[i]*n[i]);
+
+                error = fmax(error, err);
+            }
+        }
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(m);
+    free(n);
+    free(lda);
+    free(offset);
+    free(ioffset);
+    free(A);
+    free(ipiv);
+    free(pA);
+    free(pipiv);
+    free(info);
+    if (test) {
+        free(Aref);
+        free(ipivref);
+    }
+}
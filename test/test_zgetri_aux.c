@@ -109,6 +109,7 @@ void test_zgetri_aux(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     plasma_zgetri_aux( n, A, lda );
@@ -118,6 +118,7 @@ void test_zgetrs(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zgetrs(n, nrhs, A, lda, ipiv, B, ldb);
     plasma_time_t stop = omp_get_wtime();
@@ -0,0 +1,243 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "core_blas.h"
+#include "core_lapack.h"
+#include "plasma.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+/***************************************************************************//**
+ *
+ * @brief Tests ZGETRS_BATCH.
+ *        Solves --batch systems of size --dim, or with --vary=y, of
+ *        sizes up to --dim, with plasma_zgetrs_vbatch. Gflop/s is for the
+ *        whole batch, and the error is the largest residual.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_zgetrs_batch(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_DIM    ].used = PARAM_USE_N;
+    param[PARAM_NRHS   ].used = true;
+    param[PARAM_PADA   ].used = true;
+    param[PARAM_PADB   ].used = true;
+    param[PARAM_BATCH  ].used = true;
+    param[PARAM_VARY   ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    int batch = param[PARAM_BATCH].i;
+    char vary = param[PARAM_VARY].c;
+
+    int test = param[PARAM_TEST].c == 'y';
+    double tol = param[PARAM_TOL].d * LAPACKE_dlamch('E');
+
+    //================================================================
+    // Set sizes of the problems.
+    //================================================================
+    int *n = (int*)malloc((size_t)batch*sizeof(int));
+    assert(n != NULL);
+
+    int *nrhs = (int*)malloc((size_t)batch*sizeof(int));
+    assert(nrhs != NULL);
+
+    int *lda = (int*)malloc((size_t)batch*sizeof(int));
+    assert(lda != NULL);
+
+    int *ldb = (int*)malloc((size_t)batch*sizeof(int));
+    assert(ldb != NULL);
+
+    size_t *offset = (size_t*)malloc((size_t)(batch+1)*sizeof(size_t));
+    assert(offset != NULL);
+
+    size_t *ioffset = (size_t*)malloc((size_t)(batch+1)*sizeof(size_t));
+    assert(ioffset != NULL);
+
+    // Each problem takes its A and B in turn from one array.
+    double flops = 0.0;
+    offset[0] = 0;
+    ioffset[0] = 0;
+    for (int i = 0; i < batch; i++) {
+        n[i] = batch_size(param[PARAM_DIM].dim.n, 2*i, vary);
+        nrhs[i] = batch_size(param[PARAM_NRHS].i, 2*i+1, vary);
+        lda[i] = imax(1, n[i] + param[PARAM_PADA].i);
+        ldb[i] = imax(1, n[i] + param[PARAM_PADB].i);
+        offset[i+1] = offset[i] + (size_t)lda[i]*n[i]
+                                + (size_t)ldb[i]*nrhs[i];
+        ioffset[i+1] = ioffset[i] + (size_t)n[i];
+        flops += flops_zgetrs(n[i], nrhs[i]);
+    }
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex64_t *AB =
+        (plasma_complex64_t*)malloc(offset[batch]*sizeof(plasma_complex64_t));
+    assert(AB != NULL);
+
+    int *ipiv = (int*)malloc((ioffset[batch]+1)*sizeof(int));
+    assert(ipiv != NULL);
+
+    plasma_complex64_t **pA =
+        (plasma_complex64_t**)malloc((size_t)batch*sizeof(plasma_complex64_t*));
+    assert(pA != NULL);
+
+    plasma_complex64_t **pB =
+        (plasma_complex64_t**)malloc((size_t)batch*sizeof(plasma_complex64_t*));
+    assert(pB != NULL);
+
+    int **pipiv = (int**)malloc((size_t)batch*sizeof(int*));
+    assert(pipiv != NULL);
+
+    int *info = (int*)malloc((size_t)batch*sizeof(int));
+    assert(info != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_zlarnv(1, seed, offset[batch], AB);
+    assert(retval == 0);
+
+    for (int i = 0; i < batch; i++) {
+        pA[i] = &AB[offset[i]];
+        pB[i] = pA[i] + (size_t)lda[i]*n[i];
+        pipiv[i] = &ipiv[ioffset[i]];
+    }
+
+    plasma_complex64_t *ABref = NULL;
+    if (test) {
+        ABref = (plasma_complex64_t*)malloc(
+            offset[batch]*sizeof(plasma_complex64_t));
+        assert(ABref != NULL);
+
+        memcpy(ABref, AB, offset[batch]*sizeof(plasma_complex64_t));
+    }
+
+    //================================================================
+    // Run GETRF_BATCH
+    //================================================================
+    if (vary == 'y')
+        plasma_zgetrf_vbatch(n, n, pA, lda, pipiv, info, batch);
+    else
+        plasma_zgetrf_batch(param[PARAM_DIM].dim.n, param[PARAM_DIM].dim.n,
+                            pA, batch > 0 ? lda[0] : 1,
+                            pipiv, info, batch);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    test_flush_cache(param);
+    plasma_time_t start = omp_get_wtime();
+    int plainfo;
+    if (vary == 'y')
+        plainfo = plasma_zgetrs_vbatch(n, nrhs, pA, lda, pipiv,
+                                       pB, ldb, batch);
+    else
+        plainfo = plasma_zgetrs_batch(param[PARAM_DIM].dim.n,
+                                      param[PARAM_NRHS].i,
+                                      pA, batch > 0 ? lda[0] : 1, pipiv,
+                                      pB, batch > 0 ? ldb[0] : 1, batch);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops / time / 1e9;
+
+    //================================================================
+    // Test results by checking the residual of each problem
+    //
+    //                      || B - AX ||_I
+    //                --------------------------- < epsilon
+    //                 || A ||_I * || X ||_I * N
+    //
+    //================================================================
+    if (test) {
+        plasma_complex64_t zone  =  1.0;
+        plasma_complex64_t zmone = -1.0;
+
+        double *work = (double*)malloc(
+            (size_t)imax(1, param[PARAM_DIM].dim.n)*sizeof(double));
+        assert(work != NULL);
+
+        double error = plainfo == PlasmaSuccess ? 0.0 : INFINITY;
+        for (int i = 0; i < batch; i++) {
+            if (n[i] == 0 || nrhs[i] == 0)
+                continue;
+
+            if (info[i] != 0) {
+                error = INFINITY;
+                continue;
+            }
+
+            plasma_complex64_t *Aref = &ABref[offset[i]];
+            plasma_complex64_t *Bref = Aref + (size_t)lda[i]*n[i];
+
+            double Anorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'I', n[i], n[i], Aref, lda[i], work);
+            double Xnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'I', n[i], nrhs[i], pB[i], ldb[i], work);
+
+            // Bref -= Aref*X
+            cblas_zgemm(CblasColMajor, CblasNoTrans, CblasNoTrans,
+                        n[i], nrhs[i], n[i],
+                        CBLAS_SADDR(zmone), Aref,  lda[i],
+                                            pB[i], ldb[i],
+                        CBLAS_SADDR(zone),  Bref,  ldb[i]);
+
+            double Rnorm = LAPACKE_zlange_work(
+                LAPACK_COL_MAJOR, 'I', n[i], nrhs[i], Bref, ldb[i], work);
+            double residual = Rnorm/(n[i]*Anorm*Xnorm);
+
+            error = fmax(error, residual);
+        }
+        free(work);
+
+        param[PARAM_ERROR].d = error;
+        param[PARAM_SUCCESS].i = error < tol;
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(n);
+    free(nrhs);
+    free(lda);
+    free(ldb);
+    free(offset);
+    free(ioffset);
+    free(AB);
+    free(ipiv);
+    free(pA);
+    free(pB);
+    free(pipiv);
+    free(info);
+    if (test)
+        free(ABref);
+}
@@ -137,6 +137,7 @@ void test_zhemm(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     plasma_zhemm(
@@ -133,6 +133,7 @@ void test_zher2k(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     plasma_zher2k(
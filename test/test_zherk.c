@@ -119,6 +119,7 @@ void test_zherk(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     plasma_zherk(
@@ -149,6 +149,7 @@ void test_zhesv(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zhesv(uplo, n, nrhs, A, lda, ipiv, T, ldt, ipiv2, X, ldx);
     plasma_time_t stop = omp_get_wtime();
@@ -125,6 +125,7 @@ void test_zhetrf(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zhetrf(uplo, n, A, lda, ipiv, T, ldt, ipiv2);
     plasma_time_t stop = omp_get_wtime();
@@ -112,6 +112,7 @@ void test_zlacpy(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     retval = plasma_zlacpy(uplo, transa, m, n, A, lda, B, ldb);
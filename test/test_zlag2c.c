@@ -92,6 +92,7 @@ void test_zlag2c(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     retval = plasma_zlag2c(m, n, A, lda, As, ldas);
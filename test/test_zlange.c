@@ -91,6 +91,7 @@ void test_zlange(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     double value = plasma_zlange(norm, m, n, A, lda);
     plasma_time_t stop = omp_get_wtime();
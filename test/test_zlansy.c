@@ -96,6 +96,7 @@ void test_zlansy(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     double value = plasma_zlansy(norm, uplo, n, A, lda);
     plasma_time_t stop = omp_get_wtime();
@@ -89,6 +89,7 @@ void test_zlascl(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zlascl(uplo, 1.234, 5.678, m, n, A, lda);
     plasma_time_t stop = omp_get_wtime();
@@ -92,6 +92,7 @@ void test_zlaset(param_value_t param[], bool run)
     plasma_complex64_t alpha = 1.234+5.678*I;
     plasma_complex64_t beta = 2.345+6.789*I;
 
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     retval = plasma_zlaset(uplo, m, n, alpha, beta, A, lda);
     plasma_time_t stop = omp_get_wtime();
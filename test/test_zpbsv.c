@@ -162,6 +162,7 @@ void test_zpbsv(param_value_t param[], bool run)
     //================================================================
     int plainfo;
 
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plainfo = plasma_zpbsv(uplo, n, kd, nrhs, AB, ldab, X, ldx);
     plasma_time_t stop = omp_get_wtime();
@@ -140,6 +140,7 @@ void test_zpbtrf(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zpbtrf(uplo, n, kd, AB, ldab);
     plasma_time_t stop = omp_get_wtime();
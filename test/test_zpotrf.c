@@ -47,6 +47,12 @@ void test_zpotrf(param_value_t param[], bool run)
     param[PARAM_DIM    ].used = PARAM_USE_N;
     param[PARAM_PADA   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_PLACEMENT].used = true;
+    param[PARAM_AFFINITY ].used = true;
+    param[PARAM_HUGE     ].used = true;
+    param[PARAM_INPLACE  ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
+    param[PARAM_GRAPH    ].used = true;
     param[PARAM_ZEROCOL].used = true;
     if (! run)
         return;
@@ -67,6 +73,18 @@ void test_zpotrf(param_value_t param[], bool run)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    plasma_set(PlasmaTilePlacement,
+               placement_const(param[PARAM_PLACEMENT].c));
+    plasma_set(PlasmaTaskAffinity,
+               param[PARAM_AFFINITY].c == 'y' ? PlasmaEnabled
+                                              : PlasmaDisabled);
+    plasma_set(PlasmaHugePages,
+               param[PARAM_HUGE].c == 'y' ? PlasmaEnabled : PlasmaDisabled);
+    plasma_set(PlasmaInplaceOutplace,
+               param[PARAM_INPLACE].c == 'y' ? PlasmaInplace : PlasmaOutplace);
+    plasma_set(PlasmaTaskGraph,
+               param[PARAM_GRAPH].c == 'y' ? PlasmaEnabled : PlasmaDisabled);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -109,6 +127,7 @@ void test_zpotrf(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zpotrf(uplo, n, A, lda);
     plasma_time_t stop = omp_get_wtime();
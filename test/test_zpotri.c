@@ -118,6 +118,7 @@ void test_zpotri(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     int plainfo = plasma_zpotri(uplo, n, A, lda);
     plasma_time_t stop = omp_get_wtime();
@@ -48,6 +48,7 @@ void test_zpotrs(param_value_t param[], bool run)
     param[PARAM_PADA   ].used = true;
     param[PARAM_PADB   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_GRAPH  ].used = true;
     if (! run)
         return;
 
@@ -69,6 +70,8 @@ void test_zpotrs(param_value_t param[], bool run)
     // Set tuning parameters.
     //================================================================
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaTaskGraph,
+               param[PARAM_GRAPH].c == 'y' ? PlasmaEnabled : PlasmaDisabled);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -127,6 +130,7 @@ void test_zpotrs(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zpotrs(uplo, n, nrhs, A, lda, B, ldb);
     plasma_time_t stop = omp_get_wtime();
@@ -128,6 +128,7 @@ void test_ztradd(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     retval = plasma_ztradd(uplo, transa, m, n, alpha, A, lda, beta, B, ldb);
@@ -123,6 +123,7 @@ void test_ztrmm(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
 
     plasma_ztrmm(side, uplo,
@@ -168,6 +168,7 @@ void test_zunmqr(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    test_flush_cache(param);
     plasma_time_t start = omp_get_wtime();
     plasma_zunmqr(side, trans,
                   bm, bn, qk,
@@ -0,0 +1,332 @@
+#!/usr/bin/env python
+#
+# Searches tile size (nb), inner block size (ib), number of panel threads
+# (mtpf) and Householder mode for PLASMA routines with the tester, and
+# writes a tuning file that PLASMA_TUNING_FILENAME can load directly.
+#
+# For each routine and size, the search is budgeted:
+#   1. a coarse grid of nb, with --kernels, only the tile sizes at which
+#      the gemm kernel of the routine's precision reaches --kernel-fraction
+#      of its best rate, as measured by tools/kernel_bench.py,
+#   2. refinement of nb around the best value, halving the step,
+#   3. ib among the divisors nb/8, nb/4, nb/2, nb, if the routine uses ib,
+#   4. panel threads 1, 2, 4, ..., threads, if the routine uses them,
+#   5. flat and tree Householder mode, if the routine uses it.
+# Each configuration runs in its own tester process, with --test=n, and
+# is rated by its best Gflop/s over --iter runs.
+#
+# The tuning file has, for each routine, piecewise functions of max(m, n),
+# switching between the tuned sizes at their geometric means.
+# Results are for the number of threads at the time of tuning.
+#
+# Usage (from the PLASMA root, after make):
+#     tools/autotune.py [options] routine [routine ...] > tuning/mine.lua
+#
+# Example:
+#     tools/autotune.py --sizes=1000,4000,16000 --budget=20 \
+#         -o tuning/epyc.lua dgetrf dpotrf dgeqrf dgemm
+
+from __future__ import print_function
+
+import argparse
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+import time
+
+# ------------------------------------------------------------------------------
+parser = argparse.ArgumentParser(
+    description='Autotunes PLASMA routines and writes a Lua tuning file.')
+parser.add_argument('routines', nargs='+',
+                    help='tester routines, e.g., dgetrf dpotrf')
+parser.add_argument('--test', default='./test/test',
+                    help='tester [default: ./test/test]')
+parser.add_argument('--sizes', default='1000,2000,4000,8000',
+                    help='matrix sizes to tune [default: 1000,2000,4000,8000]')
+parser.add_argument('--nb', default='64:768:128',
+                    help='coarse grid of nb, start:end:step '
+                         '[default: 64:768:128]')
+parser.add_argument('--min-step', type=int, default=16,
+                    help='smallest refinement step of nb [default: 16]')
+parser.add_argument('--budget', type=int, default=24,
+                    help='max configurations per routine and size '
+                         '[default: 24]')
+parser.add_argument('--iter', type=int, default=3,
+                    help='runs of each configuration [default: 3]')
+parser.add_argument('--threads', type=int,
+                    default=int(os.environ.get('OMP_NUM_THREADS', '0') or 0),
+                    help='max panel threads [default: OMP_NUM_THREADS]')
+parser.add_argument('--kernels',
+                    help='JSON file of tile kernel rates written by '
+                         'tools/kernel_bench.py [default: none]')
+parser.add_argument('--kernel-fraction', type=float, default=0.8,
+                    help='fraction of the best gemm kernel rate a coarse nb '
+                         'needs with --kernels [default: 0.8]')
+parser.add_argument('-o', '--output', help='tuning file [default: stdout]')
+parser.add_argument('-v', '--verbose', action='store_true',
+                    help='print each configuration to stderr')
+opts = parser.parse_args()
+
+# ------------------------------------------------------------------------------
+def parse_columns(out):
+    '''
+    Parses the tester output into a list of dicts, one per result line,
+    mapping column headers to values. Headers and values are printed
+    right-aligned in the same widths, so each header ends where its
+    values end.
+    '''
+    rows = []
+    columns = None
+    for line in out.splitlines():
+        if ('Gflop/s' in line):
+            columns = []
+            for match in re.finditer(r'\S+( \S+)*', line):
+                columns.append((match.group(), match.end()))
+        elif (columns and line.strip()):
+            row = {}
+            begin = 0
+            for (name, end) in columns:
+                row[name] = line[begin:end].strip()
+                begin = end
+            rows.append(row)
+    return (columns, rows)
+# end
+
+# ------------------------------------------------------------------------------
+cache = {}
+
+def run(routine, size, config):
+    '''
+    Runs the tester for one configuration, a dict of tester options,
+    returning its best Gflop/s, or 0 if it failed.
+    '''
+    key = (routine, size, tuple(sorted(config.items())))
+    if (key in cache):
+        return cache[key]
+
+    cmd = [opts.test, routine, '--dim=%d' % size, '--test=n',
+           '--iter=%d' % opts.iter]
+    cmd += ['--%s=%s' % (opt, value) for (opt, value) in sorted(config.items())]
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE,
+                            stderr=subprocess.PIPE,
+                            universal_newlines=True)
+    (out, err) = proc.communicate()
+    (columns, rows) = parse_columns(out)
+    gflops = 0.0
+    for row in rows:
+        try:
+            gflops = max(gflops, float(row.get('Gflop/s', 0)))
+        except ValueError:
+            pass
+    if (opts.verbose):
+        print('    %-8s %6d  %-40s %10.2f Gflop/s' %
+              (routine, size, ' '.join(cmd[5:]), gflops), file=sys.stderr)
+    cache[key] = gflops
+    return gflops
+# end
+
+# ------------------------------------------------------------------------------
+def uses(routine):
+    '''
+    Returns the set of tuning options that the routine uses,
+    from the columns of its tester output for a small problem.
+    '''
+    proc = subprocess.Popen([opts.test, routine, '--dim=16', '--test=n',
+                             '--iter=1'],
+                            stdout=subprocess.PIPE, stderr=subprocess.PIPE,
+                            universal_newlines=True)
+    (out, err) = proc.communicate()
+    (columns, rows) = parse_columns(out)
+    if (not columns):
+        print('unknown routine', routine, file=sys.stderr)
+        sys.exit(1)
+    names = [name for (name, end) in columns]
+    options = set()
+    if ('ib' in names):
+        options.add('ib')
+    if ('mtpf' in names):
+        options.add('mtpf')
+    if ('House. mode' in names):
+        options.add('hmode')
+    return options
+# end
+
+# ------------------------------------------------------------------------------
+def load_kernels(file_name):
+    '''
+    Reads the tile kernel rates of tools/kernel_bench.py into a dict
+    mapping precisions to dicts mapping nb to the hot cache Gflop/s of
+    the gemm kernel.
+    '''
+    with open(file_name) as f:
+        data = json.load(f)
+    rates = {}
+    for record in data['kernels']:
+        if (record['kernel'] == 'gemm' and record['flush'] == 'n'):
+            rates.setdefault(record['precision'], {})[record['nb']] = \
+                record['gflops']
+    return rates
+# end
+
+# ------------------------------------------------------------------------------
+def kernel_grid(routine, grid):
+    '''
+    Returns the tile sizes of the grid at which the gemm kernel of the
+    routine's precision reaches --kernel-fraction of its best rate, and
+    those not measured. Returns the whole grid if none are left.
+    '''
+    rates = kernel_rates.get(routine[0], {})
+    if (not rates):
+        return grid
+    best = max(rates.values())
+    kept = [nb for nb in grid
+            if (nb not in rates or rates[nb] >= opts.kernel_fraction * best)]
+    return kept or grid
+# end
+
+# ------------------------------------------------------------------------------
+def tune(routine, size, options):
+    '''
+    Searches the configurations of the routine for one size within the
+    budget, returning the best configuration and its Gflop/s.
+    '''
+    budget = [opts.budget]
+
+    def rate(config):
+        key = (routine, size, tuple(sorted(config.items())))
+        if (key not in cache):
+            if (budget[0] <= 0):
+                return 0.0
+            budget[0] -= 1
+        return run(routine, size, config)
+
+    best = {'nb': 0}
+    if ('ib' in options):
+        best['ib'] = 0
+    if ('mtpf' in options):
+        best['mtpf'] = 1
+    if ('hmode' in options):
+        best['hmode'] = 'f'
+    best_gflops = -1.0
+
+    def consider(config):
+        gflops = rate(config)
+        if (gflops > best_gflops):
+            return (dict(config), gflops)
+        return (best, best_gflops)
+
+    # Coarse grid of nb, with ib = nb/4 if used.
+    (start, end, step) = [int(x) for x in opts.nb.split(':')]
+    for nb in kernel_grid(routine, range(start, min(end, size) + 1, step)):
+        config = dict(best, nb=nb)
+        if ('ib' in options):
+            config['ib'] = max(1, nb//4)
+        (best, best_gflops) = consider(config)
+
+    # Refinement of nb, halving the step.
+    step //= 2
+    while (step >= opts.min_step and budget[0] > 0):
+        center = best['nb']
+        for nb in (center - step, center + step):
+            if (nb <= 0 or nb > size):
+                continue
+            config = dict(best, nb=nb)
+            if ('ib' in options):
+                config['ib'] = max(1, nb//4)
+            (best, best_gflops) = consider(config)
+        step //= 2
+
+    # ib among divisors of nb.
+    if ('ib' in options):
+        nb = best['nb']
+        for ib in sorted(set([nb//8, nb//4, nb//2, nb])):
+            if (ib >= 4 and nb % ib == 0):
+                (best, best_gflops) = consider(dict(best, ib=ib))
+
+    # Panel threads in powers of 2.
+    if ('mtpf' in options):
+        mtpf = 2
+        while (mtpf <= max(opts.threads, 1)):
+            (best, best_gflops) = consider(dict(best, mtpf=mtpf))
+            mtpf *= 2
+
+    # Householder mode.
+    if ('hmode' in options):
+        (best, best_gflops) = consider(dict(best, hmode='t'))
+
+    return (best, best_gflops)
+# end
+
+# ------------------------------------------------------------------------------
+def lua_piecewise(name, bands):
+    '''
+    Returns a Lua function that returns, for each precision, the value
+    of the band with size nearest to max(m, n) in log scale, and nil for
+    other precisions.
+    bands maps precision to a list of (size, value).
+    '''
+    lines = ['function %s (type, m, n, k, threads)' % name,
+             '\tlocal s = math.max(m, n)']
+    for (precision, values) in sorted(bands.items()):
+        lines.append('\tif type == "%s" then' % precision)
+        for i in range(len(values) - 1):
+            bound = int(math.sqrt(values[i][0] * values[i+1][0]))
+            lines.append('\t\tif s < %d then return %s end' %
+                         (bound, lua_value(values[i][1])))
+        lines.append('\t\treturn %s' % lua_value(values[-1][1]))
+        lines.append('\tend')
+    lines.append('end')
+    return '\n'.join(lines)
+# end
+
+# ------------------------------------------------------------------------------
+def lua_value(value):
+    if (value == 'f'):
+        return '"flat"'
+    if (value == 't'):
+        return '"tree"'
+    return str(value)
+# end
+
+# ------------------------------------------------------------------------------
+sizes = [int(x) for x in opts.sizes.split(',')]
+kernel_rates = load_kernels(opts.kernels) if opts.kernels else {}
+
+# results[name][option][precision] = [(size, value), ...]
+results = {}
+for routine in opts.routines:
+    precision = routine[0].upper()
+    name = routine[1:]
+    options = uses(routine)
+    print('tuning', routine, file=sys.stderr)
+    for size in sizes:
+        (best, gflops) = tune(routine, size, options)
+        print('  %6d  %s  %.2f Gflop/s' %
+              (size, ' '.join('%s=%s' % item for item in sorted(best.items())),
+               gflops), file=sys.stderr)
+        for (option, value) in best.items():
+            results.setdefault(name, {}).setdefault(option, {}) \
+                   .setdefault(precision, []).append((size, value))
+
+functions = {'nb': 'nb', 'ib': 'ib', 'mtpf': 'max_panel_threads',
+             'hmode': 'householder_mode'}
+
+output = ['-- Generated by tools/autotune.py on %s' % time.strftime('%Y-%m-%d'),
+          '-- sizes: %s, threads: %s' %
+          (opts.sizes, os.environ.get('OMP_NUM_THREADS', 'default')),
+          '']
+for name in sorted(results):
+    for option in ('nb', 'ib', 'mtpf', 'hmode'):
+        if (option in results[name]):
+            output.append(lua_piecewise('%s_%s' % (name, functions[option]),
+                                        results[name][option]))
+            output.append('')
+
+if (opts.output):
+    with open(opts.output, 'w') as f:
+        f.write('\n'.join(output))
+else:
+    print('\n'.join(output))
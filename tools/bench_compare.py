@@ -0,0 +1,133 @@
+#!/usr/bin/env python
+#
+# Compares two files of benchmark results written by the tester with
+# --output=file.json or --output=file.csv, and flags the performance
+# regressions of the second, new file against the first, baseline file.
+#
+# Results are matched by routine, number of threads, flush mode and
+# parameters. A match is a regression if its median time grew by more
+# than --threshold and by more than --noise standard deviations of the
+# two, and an improvement in the same way the other way around.
+#
+# Exits with 1 if there are regressions, else 0.
+#
+# Usage (from the PLASMA root, after make):
+#     ./test/test dgetrf --dim=1000:4000:1000 --iter=10 --bench=y \
+#         --output=base.json
+#     # ... change and rebuild PLASMA, then
+#     ./test/test dgetrf --dim=1000:4000:1000 --iter=10 --bench=y \
+#         --output=new.json
+#     tools/bench_compare.py base.json new.json
+
+from __future__ import print_function
+
+import argparse
+import csv
+import json
+import math
+import sys
+
+# ------------------------------------------------------------------------------
+parser = argparse.ArgumentParser(
+    description='Flags performance regressions between two tester '
+                'benchmark result files.')
+parser.add_argument('base', help='baseline results, .json or .csv')
+parser.add_argument('new', help='new results, .json or .csv')
+parser.add_argument('--threshold', type=float, default=0.05,
+                    help='relative change of the median time flagged '
+                         '[default: 0.05]')
+parser.add_argument('--noise', type=float, default=2.0,
+                    help='standard deviations a change must exceed '
+                         '[default: 2]')
+parser.add_argument('-v', '--verbose', action='store_true',
+                    help='print all matched results, not only changes')
+opts = parser.parse_args()
+
+# Statistics and records of the runs, which are not part of the key.
+stats_columns = ('min', 'median', 'mean', 'stddev', 'max')
+record_columns = ('plasma_nb', 'plasma_ib', 'iter', 'warmup', 'status',
+                  'build')
+
+# ------------------------------------------------------------------------------
+def load(file_name):
+    '''
+    Reads a results file into a dict mapping the key of each result, a
+    tuple of (name, value) pairs, to a dict of its time statistics
+    and status.
+    '''
+    results = {}
+    if (file_name.endswith('.json')):
+        with open(file_name) as f:
+            data = json.load(f)
+        for result in data['results']:
+            key = [('routine', data['routine']),
+                   ('threads', str(data['threads'])),
+                   ('flush', result['flush'])]
+            key += [(name, str(value))
+                    for (name, value) in result['params'].items()]
+            time = result['time']
+            results[tuple(sorted(key))] = {
+                'median': float(time['median']),
+                'stddev': float(time['stddev']),
+                'status': result['status']}
+    else:
+        with open(file_name) as f:
+            for row in csv.DictReader(f):
+                key = [(name, value) for (name, value) in row.items()
+                       if (name not in record_columns and
+                           not name.startswith('time_') and
+                           not name.startswith('gflops_'))]
+                results[tuple(sorted(key))] = {
+                    'median': float(row['time_median']),
+                    'stddev': float(row['time_stddev']),
+                    'status': row['status']}
+    return results
+# end
+
+# ------------------------------------------------------------------------------
+def label(key):
+    '''
+    Returns a short label of a key, e.g., "dgetrf threads=4 m=1000".
+    '''
+    d = dict(key)
+    rest = ['%s=%s' % (name, value) for (name, value) in key
+            if (name != 'routine')]
+    return ' '.join([d.get('routine', '?')] + rest)
+# end
+
+# ------------------------------------------------------------------------------
+base = load(opts.base)
+new = load(opts.new)
+
+regressions = 0
+improvements = 0
+matched = 0
+for key in sorted(new):
+    if (key not in base):
+        continue
+    matched += 1
+    (b, n) = (base[key], new[key])
+    change = (n['median'] - b['median']) / b['median'] if b['median'] else 0.
+    noise = opts.noise * math.sqrt(b['stddev']**2 + n['stddev']**2)
+    significant = (abs(change) > opts.threshold and
+                   abs(n['median'] - b['median']) > noise)
+    if (significant and change > 0):
+        verdict = 'REGRESSION'
+        regressions += 1
+    elif (significant):
+        verdict = 'improvement'
+        improvements += 1
+    else:
+        verdict = ''
+    if (n['status'] == 'FAILED' and b['status'] != 'FAILED'):
+        verdict = (verdict + ' FAILED').strip()
+    if (verdict or opts.verbose):
+        print('%-12s %+7.1f%%  %10.4f -> %10.4f s  %s' %
+              (verdict, 100. * change, b['median'], n['median'], label(key)))
+
+print('%d matched, %d regressions, %d improvements, %d only in %s, '
+      '%d only in %s' %
+      (matched, regressions, improvements,
+       len([k for k in base if k not in new]), opts.base,
+       len([k for k in new if k not in base]), opts.new))
+sys.exit(1 if regressions > 0 else 0)
@@ -0,0 +1,301 @@
+#!/usr/bin/env python
+#
+# Analyzes a task trace written by PLASMA built with make trace=1, e.g.,
+# of plasma_pzgetrf(), plasma_pzpotrf() or plasma_pzgeqrf(), and reports
+# for each sequence:
+#   1. the makespan, the work (time in tasks), and the critical path,
+#      the longest chain of dependent tasks, in measured task times,
+#   2. the kernels on the critical path,
+#   3. the idle intervals of each thread,
+#   4. the estimated speedup from a faster panel and from a larger
+#      lookahead.
+#
+# The task graph is rebuilt from the memory the tasks depend on, recorded
+# by PLASMA_TRACE_TASK(). Tasks are taken in the order they started: a task
+# depends on the last task writing memory it accesses, and a task writing
+# memory also depends on the tasks reading it since. Tasks recorded without
+# dependencies, e.g., the helper threads of multithreaded LU panels, count
+# in the work but are left out of the graph.
+#
+# Estimates come from list scheduling the graph on the threads of the run,
+# always starting the ready task with the longest path to the end, as a
+# lookahead deep enough never to delay the critical path would.
+# A faster panel scales the times of the panel kernels (--panel) down by
+# --panel-speedup, and is rated by the same scheduling before and after.
+#
+# Usage (from the PLASMA root, after make trace=1):
+#     PLASMA_TRACE=lu ./test/test dgetrf --dim=4000 --iter=1
+#     tools/critical_path.py lu.json
+#
+# Example:
+#     tools/critical_path.py --panel-speedup=4 --gaps=5 lu.json
+
+from __future__ import print_function
+
+import argparse
+import heapq
+import json
+import re
+import sys
+from collections import defaultdict
+
+# ------------------------------------------------------------------------------
+parser = argparse.ArgumentParser(
+    description='Critical path and idle time of a PLASMA task trace.')
+parser.add_argument('trace', help='Chrome trace JSON written by PLASMA')
+parser.add_argument('--sequence', type=int, action='append',
+                    help='sequence to analyze, may be repeated '
+                         '[default: all sequences but -1]')
+parser.add_argument('--threads', type=int, default=0,
+                    help='threads to schedule on '
+                         '[default: threads of the sequence]')
+parser.add_argument('--panel', default='getrf|geqrt|potrf',
+                    help='regex of the panel kernels '
+                         '[default: getrf|geqrt|potrf]')
+parser.add_argument('--panel-speedup', type=float, default=2.0,
+                    help='speedup of the panel kernels to estimate '
+                         '[default: 2]')
+parser.add_argument('--gaps', type=int, default=3,
+                    help='largest idle intervals listed per thread '
+                         '[default: 3]')
+opts = parser.parse_args()
+
+# ------------------------------------------------------------------------------
+class Task(object):
+    '''
+    Event of the trace, with times in ms, and dependencies as a list of
+    (begin, end, access) byte ranges.
+    '''
+    def __init__(self, event):
+        args = event.get('args', {})
+        self.name = event['name']
+        self.thread = event['tid']
+        self.start = event['ts'] / 1000.
+        self.time = event['dur'] / 1000.
+        self.stop = self.start + self.time
+        self.sequence = args.get('sequence', -1)
+        self.deps = []
+        for (addr, size, access) in args.get('deps', []):
+            if (access != 'none'):
+                begin = int(addr, 16)
+                # Dependencies on single addresses cover one byte.
+                self.deps.append((begin, begin + max(1, size), access))
+        self.pred = set()
+        self.succ = []
+# end
+
+# ------------------------------------------------------------------------------
+def load(file_name):
+    '''
+    Reads the trace, returning a dict mapping sequences to their tasks.
+    '''
+    with open(file_name) as f:
+        trace = json.load(f)
+    events = trace['traceEvents'] if isinstance(trace, dict) else trace
+    sequences = defaultdict(list)
+    for event in events:
+        if (event.get('ph') == 'X'):
+            task = Task(event)
+            sequences[task.sequence].append(task)
+    return sequences
+# end
+
+# ------------------------------------------------------------------------------
+def build_graph(tasks):
+    '''
+    Adds the dependencies between tasks, returning the tasks of the graph
+    in the order they started. Memory is split at the ends of all ranges,
+    and each piece keeps its last writer and its readers since.
+    '''
+    graph = [task for task in tasks if task.deps]
+    graph.sort(key=lambda task: (task.start, task.stop))
+
+    bounds = sorted(set([b for task in graph for dep in task.deps
+                         for b in dep[:2]]))
+    index = dict((b, i) for (i, b) in enumerate(bounds))
+    writer = [None] * len(bounds)
+    readers = [[] for b in bounds]
+
+    for task in graph:
+        for (begin, end, access) in task.deps:
+            for i in range(index[begin], index[end]):
+                if (writer[i] is not None):
+                    task.pred.add(writer[i])
+                if (access == 'in'):
+                    readers[i].append(task)
+                else:
+                    task.pred.update(readers[i])
+                    writer[i] = task
+                    readers[i] = []
+        task.pred.discard(task)
+        for pred in task.pred:
+            pred.succ.append(task)
+    return graph
+# end
+
+# ------------------------------------------------------------------------------
+def critical_path(graph, time):
+    '''
+    Returns the length and the tasks of the longest path, given the time
+    of each task.
+    '''
+    finish = {}
+    prev = {}
+    for task in graph:
+        (t, p) = max([(finish[pred], pred) for pred in task.pred] or
+                     [(0., None)], key=lambda x: x[0])
+        finish[task] = t + time(task)
+        prev[task] = p
+    if (not graph):
+        return (0., [])
+    last = max(graph, key=lambda task: finish[task])
+    path = []
+    task = last
+    while (task is not None):
+        path.append(task)
+        task = prev[task]
+    path.reverse()
+    return (finish[last], path)
+# end
+
+# ------------------------------------------------------------------------------
+def schedule(graph, time, threads):
+    '''
+    Returns the makespan of list scheduling the graph on the threads,
+    starting the ready task with the longest path to the end first.
+    '''
+    order = dict((task, i) for (i, task) in enumerate(graph))
+    level = {}
+    for task in reversed(graph):
+        level[task] = time(task) + max([level[s] for s in task.succ] or [0.])
+
+    count = dict((task, len(task.pred)) for task in graph)
+    ready = [(-level[task], order[task], task)
+             for task in graph if count[task] == 0]
+    heapq.heapify(ready)
+    running = []
+    now = 0.
+    idle = threads
+    while (ready or running):
+        while (ready and idle > 0):
+            (l, i, task) = heapq.heappop(ready)
+            heapq.heappush(running, (now + time(task), order[task], task))
+            idle -= 1
+        (now, i, task) = heapq.heappop(running)
+        idle += 1
+        for succ in task.succ:
+            count[succ] -= 1
+            if (count[succ] == 0):
+                heapq.heappush(ready, (-level[succ], order[succ], succ))
+    return now
+# end
+
+# ------------------------------------------------------------------------------
+def idle_intervals(tasks, begin, end):
+    '''
+    Returns a dict mapping threads to their idle (start, length) intervals
+    between begin and end.
+    '''
+    by_thread = defaultdict(list)
+    for task in tasks:
+        by_thread[task.thread].append((task.start, task.stop))
+    idle = {}
+    for (thread, busy) in by_thread.items():
+        busy.sort()
+        gaps = []
+        t = begin
+        for (start, stop) in busy:
+            if (start > t):
+                gaps.append((t, start - t))
+            t = max(t, stop)
+        if (end > t):
+            gaps.append((t, end - t))
+        idle[thread] = gaps
+    return idle
+# end
+
+# ------------------------------------------------------------------------------
+def analyze(sequence, tasks):
+    begin = min(task.start for task in tasks)
+    end = max(task.stop for task in tasks)
+    makespan = end - begin
+    work = sum(task.time for task in tasks)
+    threads = opts.threads or len(set(task.thread for task in tasks))
+
+    graph = build_graph(tasks)
+    measured = lambda task: task.time
+    (length, path) = critical_path(graph, measured)
+    listed = schedule(graph, measured, threads)
+
+    print('sequence %d: %d tasks, %d in the graph, %d threads' %
+          (sequence, len(tasks), len(graph), threads))
+    print('  makespan          %12.3f ms' % makespan)
+    print('  work              %12.3f ms   %5.1f%% of threads x makespan' %
+          (work, 100. * work / (threads * makespan)))
+    print('  work / threads    %12.3f ms' % (work / threads))
+    print('  critical path     %12.3f ms   %5.1f%% of makespan, %d tasks' %
+          (length, 100. * length / makespan, len(path)))
+    print('  list schedule     %12.3f ms   simulated' % listed)
+    print()
+
+    # Kernels on the critical path.
+    kernels = defaultdict(lambda: [0, 0.])
+    for task in path:
+        kernels[task.name][0] += 1
+        kernels[task.name][1] += task.time
+    print('  critical path by kernel:')
+    print('    %-24s %8s %12s %8s' % ('kernel', 'tasks', 'time ms', '%'))
+    for (name, (count, time)) in sorted(kernels.items(),
+                                        key=lambda x: -x[1][1]):
+        print('    %-24s %8d %12.3f %8.1f' %
+              (name, count, time, 100. * time / max(length, 1e-30)))
+    print()
+
+    # Idle intervals of the threads.
+    idle = idle_intervals(tasks, begin, end)
+    print('  idle time by thread:')
+    print('    %-8s %12s %8s %8s   %s' %
+          ('thread', 'idle ms', '%', 'gaps', 'largest gaps: length at time'))
+    for thread in sorted(idle):
+        gaps = idle[thread]
+        total = sum(g[1] for g in gaps)
+        largest = sorted(gaps, key=lambda g: -g[1])[:opts.gaps]
+        print('    %-8s %12.3f %8.1f %8d   %s' %
+              (thread, total, 100. * total / makespan, len(gaps),
+               ', '.join('%.3f at %.3f' % (g[1], g[0] - begin)
+                         for g in largest)))
+    print()
+
+    # Estimates.
+    panel = re.compile(opts.panel)
+    faster = lambda task: (task.time / opts.panel_speedup
+                           if panel.search(task.name) else task.time)
+    panel_work = sum(task.time for task in graph if panel.search(task.name))
+    (panel_length, panel_path) = critical_path(graph, faster)
+    panel_listed = schedule(graph, faster, threads)
+    bound = max(work / threads, length)
+
+    print('  estimates:')
+    print('    panel kernels    %12.3f ms of work, %.1f%% of critical path' %
+          (panel_work, 100. * sum(task.time for task in path
+                                  if panel.search(task.name)) /
+           max(length, 1e-30)))
+    print('    panel %gx faster: critical path %.3f ms, list schedule '
+          '%.3f ms, speedup %.2f' %
+          (opts.panel_speedup, panel_length, panel_listed,
+           listed / max(panel_listed, 1e-30)))
+    print('    larger lookahead: list schedule %.3f ms, speedup up to %.2f '
+          'over the makespan' % (listed, makespan / max(listed, 1e-30)))
+    print('    lower bound max(work / threads, critical path) %.3f ms, '
+          'speedup up to %.2f' % (bound, makespan / max(bound, 1e-30)))
+    print()
+# end
+
+# ------------------------------------------------------------------------------
+sequences = load(opts.trace)
+selected = opts.sequence or sorted(s for s in sequences if s != -1)
+for sequence in selected:
+    if (sequence not in sequences):
+        print('sequence %d not in the trace' % sequence, file=sys.stderr)
+        continue
+    analyze(sequence, sequences[sequence])
@@ -0,0 +1,168 @@
+#!/usr/bin/env python
+#
+# Times the core_blas tile kernels that the tile algorithms spend their
+# time in, core_zgemm, core_ztrsm, core_zherk, core_ztsmqr, core_zttmqr,
+# core_zgeqrt, core_zpotrf and core_zgetrf, on their own, with the tester
+# routines core_zgemm, etc.
+#
+# Each kernel runs in each precision over a sweep of tile sizes (nb) and,
+# for kernels with inner blocking, of ib, with hot caches and with caches
+# flushed before each call (tester --flush=y). A tester process runs the
+# sweep of a kernel, precision and cache mode, with OMP_NUM_THREADS=1, as
+# the kernels run on one thread each in the tasks of PLASMA.
+#
+# Prints, for each kernel, a table of the median Gflop/s of --iter runs by
+# tile size, and writes them to a JSON file (--output) that
+# tools/autotune.py --kernels and performance models can read:
+#     {"threads": 1, "kernels": [
+#         {"kernel": "gemm", "routine": "core_dgemm", "precision": "d",
+#          "flush": "n", "nb": 256, "ib": 0, "time": ..., "gflops": ...},
+#         ...]}
+# with ib 0 for kernels without inner blocking.
+#
+# Usage (from the PLASMA root, after make):
+#     tools/kernel_bench.py [options] [kernel ...]
+#
+# Example:
+#     tools/kernel_bench.py --nb=64:512:32 --ib=16,32,64 --precisions=d,z \
+#         -o kernels.json gemm tsmqr
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# ------------------------------------------------------------------------------
+# kernels, with the tester routine in each precision, and whether they use ib
+kernels = {
+    'gemm':  ({'s': 'core_sgemm',  'd': 'core_dgemm',
+               'c': 'core_cgemm',  'z': 'core_zgemm'},  False),
+    'trsm':  ({'s': 'core_strsm',  'd': 'core_dtrsm',
+               'c': 'core_ctrsm',  'z': 'core_ztrsm'},  False),
+    'herk':  ({'s': 'core_ssyrk',  'd': 'core_dsyrk',
+               'c': 'core_cherk',  'z': 'core_zherk'},  False),
+    'tsmqr': ({'s': 'core_stsmqr', 'd': 'core_dtsmqr',
+               'c': 'core_ctsmqr', 'z': 'core_ztsmqr'}, True),
+    'ttmqr': ({'s': 'core_sttmqr', 'd': 'core_dttmqr',
+               'c': 'core_cttmqr', 'z': 'core_zttmqr'}, True),
+    'geqrt': ({'s': 'core_sgeqrt', 'd': 'core_dgeqrt',
+               'c': 'core_cgeqrt', 'z': 'core_zgeqrt'}, True),
+    'potrf': ({'s': 'core_spotrf', 'd': 'core_dpotrf',
+               'c': 'core_cpotrf', 'z': 'core_zpotrf'}, False),
+    'getrf': ({'s': 'core_sgetrf', 'd': 'core_dgetrf',
+               'c': 'core_cgetrf', 'z': 'core_zgetrf'}, True),
+}
+kernel_order = ['gemm', 'trsm', 'herk', 'tsmqr', 'ttmqr', 'geqrt', 'potrf',
+                'getrf']
+
+parser = argparse.ArgumentParser(
+    description='Times the core_blas tile kernels over tile sizes.')
+parser.add_argument('kernels', nargs='*', default=kernel_order,
+                    help='kernels [default: %s]' % ' '.join(kernel_order))
+parser.add_argument('--test', default='./test/test',
+                    help='tester [default: ./test/test]')
+parser.add_argument('--precisions', default='s,d,c,z',
+                    help='precisions [default: s,d,c,z]')
+parser.add_argument('--nb', default='64:512:64',
+                    help='tile sizes, start:end:step or a list '
+                         '[default: 64:512:64]')
+parser.add_argument('--ib', default='16,32,64',
+                    help='inner block sizes, at most nb [default: 16,32,64]')
+parser.add_argument('--flush', default='n,y',
+                    help='cache modes, n for hot and y for cold caches '
+                         '[default: n,y]')
+parser.add_argument('--iter', type=int, default=3,
+                    help='runs of each configuration [default: 3]')
+parser.add_argument('-o', '--output',
+                    help='JSON file of the results [default: none]')
+parser.add_argument('-v', '--verbose', action='store_true',
+                    help='print the tester commands to stderr')
+opts = parser.parse_args()
+
+# ------------------------------------------------------------------------------
+def run(routine, use_ib, flush):
+    '''
+    Runs the tester for a kernel in one precision and cache mode,
+    returning the results read from its JSON output.
+    '''
+    (fd, output) = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    cmd = [opts.test, routine, '--nb=' + opts.nb, '--iter=%d' % opts.iter,
+           '--flush=' + flush, '--test=n', '--bench=y', '--output=' + output]
+    if (use_ib):
+        cmd.append('--ib=' + opts.ib)
+    env = dict(os.environ)
+    env['OMP_NUM_THREADS'] = '1'
+    if (opts.verbose):
+        print(' '.join(cmd), file=sys.stderr)
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE,
+                            stderr=subprocess.PIPE, env=env,
+                            universal_newlines=True)
+    proc.communicate()
+    results = []
+    try:
+        with open(output) as f:
+            results = json.load(f)['results']
+    except (IOError, ValueError, KeyError):
+        print('%s failed' % routine, file=sys.stderr)
+    os.remove(output)
+    return results
+# end
+
+# ------------------------------------------------------------------------------
+def print_table(kernel, records):
+    '''
+    Prints the Gflop/s of a kernel, a row for each nb and ib, and a
+    column for each precision and cache mode.
+    '''
+    columns = [(p, flush) for p in opts.precisions.split(',')
+               for flush in opts.flush.split(',')]
+    rates = dict(((r['precision'], r['flush'], r['nb'], r['ib']), r['gflops'])
+                 for r in records)
+    rows = sorted(set((r['nb'], r['ib']) for r in records))
+    print('%s, Gflop/s, median of %d runs' % (kernel, opts.iter))
+    print('%6s %4s ' % ('nb', 'ib') +
+          ''.join('%10s' % ('%s %s' % (p, 'cold' if flush == 'y' else 'hot'))
+                  for (p, flush) in columns))
+    for (nb, ib) in rows:
+        line = '%6d %4s ' % (nb, ib if ib else '')
+        for (p, flush) in columns:
+            gflops = rates.get((p, flush, nb, ib))
+            line += '%10.2f' % gflops if gflops is not None else '%10s' % '--'
+        print(line)
+    print()
+# end
+
+# ------------------------------------------------------------------------------
+records = []
+for kernel in opts.kernels:
+    if (kernel not in kernels):
+        print('unknown kernel', kernel, file=sys.stderr)
+        sys.exit(1)
+    (routines, use_ib) = kernels[kernel]
+    kernel_records = []
+    for precision in opts.precisions.split(','):
+        for flush in opts.flush.split(','):
+            for result in run(routines[precision], use_ib, flush):
+                nb = result['params']['nb']
+                ib = result['params'].get('ib', 0) if use_ib else 0
+                # Blocking wider than the tile is not used.
+                if (ib > nb):
+                    continue
+                kernel_records.append({
+                    'kernel': kernel, 'routine': routines[precision],
+                    'precision': precision, 'flush': flush,
+                    'nb': nb, 'ib': ib,
+                    'time': result['time']['median'],
+                    'gflops': result['gflops']['median']})
+    print_table(kernel, kernel_records)
+    records += kernel_records
+
+if (opts.output):
+    with open(opts.output, 'w') as f:
+        json.dump({'threads': 1, 'kernels': records}, f, indent=1)
+        f.write('\n')
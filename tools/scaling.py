@@ -0,0 +1,202 @@
+#!/usr/bin/env python
+#
+# Runs PLASMA routines with the tester at 1, 2, 4, ... threads, up to the
+# number of cores, and reports their strong or weak scaling.
+#
+# Strong scaling keeps the size of the problem. Weak scaling keeps the
+# flops per thread, growing the dimensions as the cube root of the
+# threads, or for band routines, e.g., gbsv, in proportion to them.
+#
+# For each number of threads, reports:
+#   1. the median time and rate of --iter runs, after one warm-up run,
+#   2. the parallel efficiency, the speedup over one thread divided by
+#      the threads, for weak scaling scaled by the flops,
+#   3. the share of the time in tasks spent translating between layouts,
+#      and the share of the threads' time spent idle, from the PLASMA
+#      statistics (tester --stats=y),
+#   4. the efficiency of each kernel, its rate relative to that at one
+#      thread, by flops or, for kernels without flops, by tasks.
+#
+# Each run is a tester process with OMP_NUM_THREADS set; thread binding
+# is left to OMP_PROC_BIND and OMP_PLACES. Other options, e.g., --nb,
+# are passed to the tester.
+#
+# Usage (from the PLASMA root, after make):
+#     tools/scaling.py [options] [routine ...] [tester options]
+#
+# Example:
+#     tools/scaling.py --weak --dim=2000 --threads=1,2,4,8 dgetrf dpotrf \
+#         --nb=256
+
+from __future__ import print_function
+
+import argparse
+import json
+import multiprocessing
+import os
+import subprocess
+import sys
+import tempfile
+
+# ------------------------------------------------------------------------------
+parser = argparse.ArgumentParser(
+    description='Strong and weak scaling of PLASMA routines over threads.')
+parser.add_argument('routines', nargs='*',
+                    default=['dgetrf', 'dpotrf', 'dgeqrf', 'dgemm', 'dsytrf',
+                             'dgbsv'],
+                    help='tester routines [default: dgetrf dpotrf dgeqrf '
+                         'dgemm dsytrf dgbsv]')
+parser.add_argument('--test', default='./test/test',
+                    help='tester [default: ./test/test]')
+parser.add_argument('--weak', action='store_true',
+                    help='weak scaling, keeping the flops per thread '
+                         '[default: strong scaling]')
+parser.add_argument('--dim', type=int, default=4000,
+                    help='dimension at one thread [default: 4000]')
+parser.add_argument('--threads', default='',
+                    help='thread counts, e.g., 1,2,4 '
+                         '[default: 1, 2, 4, ..., cores]')
+parser.add_argument('--iter', type=int, default=3,
+                    help='runs at each thread count [default: 3]')
+parser.add_argument('-v', '--verbose', action='store_true',
+                    help='print the tester commands to stderr')
+(opts, tester_opts) = parser.parse_known_args()
+
+# routines whose flops grow in proportion to the dimension
+band_routines = ('gbsv', 'gbtrf', 'pbsv', 'pbtrf')
+
+# ------------------------------------------------------------------------------
+def thread_counts():
+    '''
+    Returns the thread counts to run, by default the powers of 2 up to
+    the number of cores, and the number of cores.
+    '''
+    if (opts.threads):
+        return [int(p) for p in opts.threads.split(',')]
+    cores = multiprocessing.cpu_count()
+    counts = []
+    p = 1
+    while (p < cores):
+        counts.append(p)
+        p *= 2
+    counts.append(cores)
+    return counts
+# end
+
+# ------------------------------------------------------------------------------
+def flops_exponent(routine):
+    '''
+    Returns the exponent of the flops of the routine in its dimension.
+    '''
+    return 1. if routine[1:] in band_routines else 3.
+# end
+
+# ------------------------------------------------------------------------------
+def run(routine, threads, dim):
+    '''
+    Runs the tester at the threads, returning the result read from its
+    JSON output, or None if it failed.
+    '''
+    (fd, output) = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    cmd = [opts.test, routine, '--dim=%d' % dim, '--iter=%d' % opts.iter,
+           '--test=n', '--bench=y', '--stats=y', '--output=' + output]
+    cmd += tester_opts
+    env = dict(os.environ)
+    env['OMP_NUM_THREADS'] = str(threads)
+    if (opts.verbose):
+        print('OMP_NUM_THREADS=%d %s' % (threads, ' '.join(cmd)),
+              file=sys.stderr)
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE,
+                            stderr=subprocess.PIPE, env=env,
+                            universal_newlines=True)
+    proc.communicate()
+    result = None
+    try:
+        with open(output) as f:
+            data = json.load(f)
+        # Untested runs count as failures in the exit status.
+        if (data['results']):
+            result = data['results'][0]
+    except (IOError, ValueError, KeyError):
+        pass
+    os.remove(output)
+    return result
+# end
+
+# ------------------------------------------------------------------------------
+def kernel_rates(result):
+    '''
+    Returns a dict mapping kernels to their rates, in flops per second
+    of task time, or tasks per second for kernels without flops.
+    '''
+    rates = {}
+    for kernel in result['stats']['kernels']:
+        if (kernel['time'] > 0):
+            work = kernel['flops'] or kernel['tasks']
+            rates[kernel['name']] = work / kernel['time']
+    return rates
+# end
+
+# ------------------------------------------------------------------------------
+def scale(routine):
+    counts = thread_counts()
+    exponent = flops_exponent(routine)
+    print('%s, %s scaling, dimension %d at %d thread%s' %
+          (routine, 'weak' if opts.weak else 'strong', opts.dim, counts[0],
+           's' if counts[0] > 1 else ''))
+    print('%8s %8s %10s %10s %10s %11s %11s' %
+          ('threads', 'dim', 'time s', 'Gflop/s', 'efficiency',
+           'translate %', 'idle %'))
+
+    base = None
+    rows = []
+    for p in counts:
+        if (opts.weak):
+            dim = int(round(opts.dim * (float(p) / counts[0])**(1/exponent)))
+        else:
+            dim = opts.dim
+        result = run(routine, p, dim)
+        if (result is None):
+            print('%8d %8d %10s' % (p, dim, 'failed'))
+            continue
+
+        time = result['time']['median']
+        stats = result['stats']
+        # Work relative to the first run, from the dimensions.
+        if (base is None):
+            base = (p, dim, time, kernel_rates(result))
+        work = (float(dim) / base[1])**exponent
+        efficiency = work * base[2] * base[0] / (time * p)
+        translate = (100. * stats['translation_time'] / stats['kernel_time']
+                     if stats['kernel_time'] else 0.)
+        idle = (100. * stats['idle_time'] / (stats['time'] * stats['threads'])
+                if stats['time'] * stats['threads'] else 0.)
+        print('%8d %8d %10.4f %10.2f %9.1f%% %11.1f %11.1f' %
+              (p, dim, time, result['gflops']['median'], 100. * efficiency,
+               translate, idle))
+        rows.append((p, kernel_rates(result)))
+
+    if (not rows):
+        print()
+        return
+
+    # Efficiency of the kernels, relative to the first run.
+    print()
+    print('  kernel efficiency, rate relative to %d thread%s:' %
+          (base[0], 's' if base[0] > 1 else ''))
+    print('    %-24s' % 'kernel' + ''.join('%8d' % p for (p, r) in rows))
+    for name in sorted(base[3]):
+        line = '    %-24s' % name
+        for (p, rates) in rows:
+            if (name in rates):
+                line += '%7.1f%%' % (100. * rates[name] / base[3][name])
+            else:
+                line += '%8s' % '--'
+        print(line)
+    print()
+# end
+
+# ------------------------------------------------------------------------------
+for routine in opts.routines:
+    scale(routine)
@@ -493,6 +493,8 @@ subs = {
     ('sdesc2pb',             'ddesc2pb',             'cdesc2pb',             'zdesc2pb'            ),
     ('spb2desc',             'dpb2desc',             'cpb2desc',             'zpb2desc'            ),
 
+    ('psgraph',              'pdgraph',              'pcgraph',              'pzgraph'             ),
+
     # ----- header files
     (r'_s\.h\b',            r'_d\.h\b',             r'_c\.h\b',             r'_z\.h\b'             ),
     (r'_S_H\b',             r'_D_H\b',              r'_C_H\b',              r'_Z_H\b'              ),
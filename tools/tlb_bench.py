@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Compares dTLB miss rates and Gflop/s of a PLASMA routine with regular
+# and huge page allocation of tiles and workspaces (--huge=n vs. --huge=y).
+# Each mode runs in its own process under perf stat, so that the counters
+# cover only that mode.
+#
+# Usage (from the PLASMA root, after make):
+#     tools/tlb_bench.py [--test=./test/test] [routine] [tester options]
+#
+# Example:
+#     tools/tlb_bench.py dgetrf --dim=20000 --nb=256 --iter=3 --test=n
+#
+# Requires Linux perf with access to the dTLB events
+# (see /proc/sys/kernel/perf_event_paranoid).
+
+from __future__ import print_function
+
+import re
+import subprocess
+import sys
+
+events = ['dTLB-loads', 'dTLB-load-misses', 'dTLB-stores', 'dTLB-store-misses']
+
+# ------------------------------------------------------------------------------
+def run(tester, routine, options, huge):
+    '''
+    Runs the tester under perf stat, returning (gflops, counters), where
+    gflops is the list of Gflop/s values and counters maps events to counts.
+    '''
+    cmd = (['perf', 'stat', '-x,', '-e', ','.join(events),
+            tester, routine, '--huge=' + huge] + options)
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE,
+                            stderr=subprocess.PIPE,
+                            universal_newlines=True)
+    (out, err) = proc.communicate()
+    if (proc.returncode != 0 and not out):
+        print(err, file=sys.stderr)
+        sys.exit(1)
+
+    # Find the Gflop/s column in the tester output.
+    gflops = []
+    column = None
+    for line in out.splitlines():
+        words = line.split()
+        if ('Gflop/s' in words):
+            column = words.index('Gflop/s')
+        elif (column is not None and len(words) > column
+              and re.match(r'^[0-9.]+$', words[column])):
+            gflops.append(float(words[column]))
+
+    # perf stat -x, prints: value,unit,event,...
+    counters = {}
+    for line in err.splitlines():
+        fields = line.split(',')
+        if (len(fields) > 2 and fields[2] in events):
+            try:
+                counters[fields[2]] = int(fields[0])
+            except ValueError:
+                counters[fields[2]] = None  # <not supported> or <not counted>
+    return (gflops, counters)
+# end
+
+# ------------------------------------------------------------------------------
+def rate(counters, misses, accesses):
+    m = counters.get(misses)
+    a = counters.get(accesses)
+    if (m is None or not a):
+        return '--'
+    return '%.4f%%' % (100.0*m/a)
+# end
+
+# ------------------------------------------------------------------------------
+tester = './test/test'
+args = sys.argv[1:]
+if (args and args[0].startswith('--test=')):
+    tester = args.pop(0).split('=', 1)[1]
+routine = args.pop(0) if args else 'dgetrf'
+
+print('%-6s  %12s  %12s  %16s  %16s' %
+      ('huge', 'avg Gflop/s', 'max Gflop/s',
+       'dTLB load miss', 'dTLB store miss'))
+for huge in ('n', 'y'):
+    (gflops, counters) = run(tester, routine, args, huge)
+    avg = sum(gflops)/len(gflops) if gflops else 0.0
+    top = max(gflops) if gflops else 0.0
+    print('%-6s  %12.2f  %12.2f  %16s  %16s' %
+          (huge, avg, top,
+           rate(counters, 'dTLB-load-misses', 'dTLB-loads'),
+           rate(counters, 'dTLB-store-misses', 'dTLB-stores')))
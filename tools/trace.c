@@ -1,3 +1,6 @@
+// PLASMA built with trace=1 traces the tasks of its kernels by itself,
+// see include/plasma_trace.h. This file is for tracing other code.
+//
 // Compile this file to an object file, e.g.:
 //
 //     gcc -O3 -c -o trace.o trace.c
@@ -1,4 +1,12 @@
 
+-- PLASMA looks up the parameters of a routine, e.g., getrf, in functions
+-- <routine>_nb, <routine>_ib, <routine>_max_panel_threads and
+-- <routine>_householder_mode (returning "flat" or "tree"), called as
+-- (type, m, n, k, threads), where type is "S", "D", "C" or "Z" and k is
+-- the number of right-hand sides or the inner dimension (0 if none).
+-- Missing functions and functions returning nil leave the defaults,
+-- and parameters set with plasma_set() take precedence.
+
 function getrf_nb (type, m, n)
 	return 256
 end